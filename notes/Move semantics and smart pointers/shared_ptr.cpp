@@ -236,43 +236,64 @@
       /* 
         Shared pointer class implementation
        */
+      /*
+        The sketch that was here (ControlBlock new-ed on its own, plain int count) is finished in
+        practice/SharedPointer.h:
+            > makeShared<T>(args...) : one allocation, the block constructs T in its own storage with placement new
+            > strong & weak counts are std::atomic, so copies can be made & dropped from any thread
+            > WeakPointer<T> with lock() / expired(), aliasing constructor SharedPointer<int>{ pairPtr, &pairPtr->first}
+       */
       #if 0
-      template<typename T>
-      class SharedPointer{
-          template typename<T>
-          class ControlBlock{
-              public:
-                T * m_managedObj{};
-                int m_refCount{};
-                ControlBlock(T* ptr)
-                    :m_managedObj(ptr), m_refCount{1} {
-                }
-                int getRefCount(){ return m_refcount;};
-                int getObj(){ return m_managedObj;}
-                ~ControlBlock(){
-                    std::cout<<"delete m_managedObj\n";
-                    delete m_managedObj;
-                }
-                void operator++(){ ++m_refCount;}
-                int operator++(int) { 
-                    auto ret {m_refCount};
-                    ++m_refCount;
-                    return ret;
-                }
-                void operator--(){ --m_refCount;}
-                int operator(int){ 
-                    auto ret {m_refCount};
-                    --m_refCount;
-                    return ret;
-                }
-            };
-        ControlBlock<T> *m_controlBlock;
-        SharedPointer(T *ptr= nullptr)
-            : m_controlBlock{new m_controlBlock<T>{ptr}}{}
-        //copy
-        SharedPointer
-
-      };
+        #include"../../practice/SharedPointer.h"
+        int main(){
+            auto ptr1{ makeShared<Resource>()};// Resource acquired, block & Resource in one allocation
+            WeakPointer<Resource> weak{ ptr1};
+            {
+                auto ptr2{ ptr1};
+                std::cout << "Killing one shared pointer, count " << ptr2.useCount() << '\n';
+            }
+            auto pair{ makeShared<std::pair<int, double>>(42, 3.14)};
+            SharedPointer<int> first{ pair, &pair->first};// keeps the whole pair alive
+            pair.reset();
+            std::cout << "first " << *first << '\n';
+            std::cout << "Killing another shared pointer\n";
+            ptr1.reset();// Resource destroyed
+            std::cout << "expired " << weak.expired() << '\n';
+            return 0;
+        }
+        /* output
+            Resource acquired
+            Killing one shared pointer, count 2
+            first 42
+            Killing another shared pointer
+            Resource destroyed
+            expired 1
+         */
+      #endif
+      /*
+        The atomic counts cost a lock-prefixed add on every copy even when one thread owns the whole
+        graph. practice/LocalSharedPtr.h: LocalSharedPtr / LocalWeakPtr, same interface, plain counts
+            > debug builds assert if a count is touched from another thread than the creating one
+            > toShared() hands a LocalSharedPtr that is the only reference over to a SharedPointer
+       */
+      #if 0
+        #include"../../practice/LocalSharedPtr.h"
+        int main(){
+            auto lucy{ makeLocalShared<Resource>()};// Resource acquired
+            LocalWeakPtr<Resource> weak{ lucy};
+            std::cout << "shared " << static_cast<bool>(lucy.toShared()) << '\n';// weak still refers to it
+            weak.reset();
+            SharedPointer<Resource> shared{ lucy.toShared()};// lucy is empty now
+            std::thread{ [shared]{}}.join();// may be copied & dropped by any thread
+            std::cout << "moved " << !lucy << '\n';
+            return 0;
+        }
+        /* output
+            Resource acquired
+            shared 0
+            moved 1
+            Resource destroyed
+         */
       #endif
 
 /* // to avoid circular dependency weak_ptr are used
@@ -0,0 +1,72 @@
+#ifndef __ARRAYINT_H
+#define __ARRAYINT_H
+    // ArrayInt & ArrayException from Exception.cpp, plus a non-throwing access path:
+    // try_at() returns Expected<int&, ArrayError> (see Expected.h) for code that can't or won't throw.
+    // The throwing operator[] only exists when exceptions are enabled, so -fno-exceptions builds can
+    // still include this header and use try_at() / uncheckedAt()
+    #include<cstdint>
+    #include<exception>
+    #include<string>
+    #include<string_view>
+    #include"Expected.h"
+
+    // error codes are plain enum values: nothing to allocate, cheap to return in a register
+    enum class ArrayError : std::uint8_t{
+        negativeIndex,
+        indexPastEnd,
+        max_errors
+    };
+    constexpr const char * getErrorString(ArrayError error){
+        switch(error){
+            case ArrayError::negativeIndex: return "Invalid index (negative)";
+            case ArrayError::indexPastEnd:  return "Invalid index (past the end)";
+            default: return "Invalid index";
+        }
+    }
+
+    class ArrayException : public std::exception{
+        std::string m_error{};
+        const char * m_staticError{ nullptr};// static message mode, what() never needs the string
+        ArrayError m_code{ ArrayError::max_errors};
+    public: 
+        ArrayException(std::string_view error)
+        :m_error{error}{}
+        // allocation free: the message is the string literal of the error code
+        ArrayException(ArrayError error) noexcept
+        :m_staticError{ getErrorString(error)}, m_code{error}{}
+        const char *what() const noexcept override{
+            return m_staticError ? m_staticError : m_error.c_str();
+        }
+        ArrayError getCode() const noexcept { return m_code;}
+    };
+    class ArrayInt{
+        int m_data[3]{};
+        int m_size{};
+        // one check shared by the throwing & the expected path; valid indices are 0 .. m_size-1
+        constexpr bool isValidIndex(int idx) const { return idx >= 0 && idx < m_size;}
+        constexpr ArrayError getIndexError(int idx) const {
+            return idx < 0 ? ArrayError::negativeIndex : ArrayError::indexPastEnd;
+        }
+    public:
+        ArrayInt():m_size(3){
+        };
+        int getLength(){ return 3;}
+    #if __cpp_exceptions
+        int & operator[](int idx){
+            if(!isValidIndex(idx)){
+               // throw std::length_error("Invalid array index access");
+               throw ArrayException{ getIndexError(idx)};
+            }
+            return m_data[idx];
+        }
+    #endif
+        Expected<int &, ArrayError> try_at(int idx) noexcept {
+            if(!isValidIndex(idx))
+                return unexpected(getIndexError(idx));
+            return m_data[idx];
+        }
+        // no check at all; caller guarantees 0 <= idx < getLength()
+        int & uncheckedAt(int idx) noexcept { return m_data[idx];}
+        ~ArrayInt(){ }  
+    };
+#endif
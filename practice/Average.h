@@ -0,0 +1,169 @@
+#ifndef __AVERAGE_H
+#define __AVERAGE_H
+    /*
+        Average from overloadingExamples.cpp as a streaming aggregator.
+        The original keeps the count in std::int_least8_t (wraps after 127 samples) and the sum in
+        32 bits, and two partial averages can't be combined. This one:
+        > 64 bit count
+        > sum with Neumaier's compensated summation: the rounding error of every addition is kept in a
+          second double, so adding 1e7 values loses no more than a couple of ulps
+        > Welford's running mean & sum of squared deviations (m2) for the variance: no sum-of-squares
+          cancellation when the samples sit far from zero
+        > min/max
+        > merge(): Chan et al. pairwise update, so per-thread accumulators combine exactly as if one
+          accumulator had seen all the samples (up to rounding). parallelAverage() does that over an array
+        > add(first, n): block path for arrays, see below
+    */
+    #include<algorithm>
+    #include<cmath>
+    #include<cstdint>
+    #include<limits>
+    #include<ostream>
+    #include<thread>
+    #include<vector>
+
+    class Average{
+        std::uint64_t m_count{};
+        double m_sum{};
+        double m_compensation{};// Neumaier: what m_sum lost to rounding so far
+        double m_mean{};
+        double m_m2{};// sum of squared deviations from the mean
+        double m_min{ std::numeric_limits<double>::infinity()};
+        double m_max{ -std::numeric_limits<double>::infinity()};
+
+        static void addCompensated(double & sum, double & compensation, double x){
+            const double t{ sum + x};
+            if(std::fabs(sum) >= std::fabs(x))
+                compensation += (sum - t) + x;
+            else
+                compensation += (x - t) + sum;
+            sum = t;
+        }
+    public:
+        Average & operator+=(double x){
+            ++m_count;
+            addCompensated(m_sum, m_compensation, x);
+            const double delta{ x - m_mean};
+            m_mean += delta / static_cast<double>(m_count);
+            m_m2 += delta * (x - m_mean);
+            m_min = std::min(m_min, x);
+            m_max = std::max(m_max, x);
+            return *this;
+        }
+        // Arrays go through blocks of 1024: per block a compensated sum, then the squared deviations
+        // from the block mean (two passes over data still in L1, no division per sample), and the block
+        // is merged in like another accumulator. Both passes keep 4 independent accumulators so the
+        // loop isn't bound by the latency of one chain of additions
+        template<typename T>
+        void add(const T * first, std::size_t n){
+            constexpr std::size_t blockSize{ 1024};
+            constexpr std::size_t lanes{ 4};
+            for(std::size_t start{}; start < n; start += blockSize){
+                const T * block{ first + start};
+                const std::size_t len{ std::min(blockSize, n - start)};
+                const std::size_t unrolled{ len - len % lanes};
+                // locals rather than part's members: stores through a double & could alias block[]
+                double sum[lanes]{}, compensation[lanes]{};
+                double low{ std::numeric_limits<double>::infinity()}, high{ -low};
+                for(std::size_t i{}; i < unrolled; i += lanes){
+                    for(std::size_t lane{}; lane < lanes; ++lane){
+                        const double x{ static_cast<double>(block[i + lane])};
+                        addCompensated(sum[lane], compensation[lane], x);
+                        low = std::min(low, x);
+                        high = std::max(high, x);
+                    }
+                }
+                for(std::size_t i{ unrolled}; i < len; ++i){
+                    const double x{ static_cast<double>(block[i])};
+                    addCompensated(sum[0], compensation[0], x);
+                    low = std::min(low, x);
+                    high = std::max(high, x);
+                }
+                Average part{};
+                part.m_count = len;
+                for(std::size_t lane{}; lane < lanes; ++lane){
+                    addCompensated(part.m_sum, part.m_compensation, sum[lane]);
+                    part.m_compensation += compensation[lane];
+                }
+                part.m_min = low;
+                part.m_max = high;
+                part.m_mean = part.getSum() / static_cast<double>(len);
+                const double mean{ part.m_mean};
+                double deviations[lanes]{}, squares[lanes]{};
+                for(std::size_t i{}; i < unrolled; i += lanes){
+                    for(std::size_t lane{}; lane < lanes; ++lane){
+                        const double d{ static_cast<double>(block[i + lane]) - mean};
+                        deviations[lane] += d;
+                        squares[lane] += d * d;
+                    }
+                }
+                for(std::size_t i{ unrolled}; i < len; ++i){
+                    const double d{ static_cast<double>(block[i]) - mean};
+                    deviations[0] += d;
+                    squares[0] += d * d;
+                }
+                const double deviation{ (deviations[0] + deviations[1]) + (deviations[2] + deviations[3])};
+                // corrects for the rounding of the block mean
+                part.m_m2 = (squares[0] + squares[1]) + (squares[2] + squares[3])
+                          - deviation * deviation / static_cast<double>(len);
+                merge(part);
+            }
+        }
+        void merge(const Average & other){
+            if(other.m_count == 0)
+                return;
+            if(m_count == 0){
+                *this = other;
+                return;
+            }
+            const double a{ static_cast<double>(m_count)};
+            const double b{ static_cast<double>(other.m_count)};
+            const double delta{ other.m_mean - m_mean};
+            m_count += other.m_count;
+            addCompensated(m_sum, m_compensation, other.m_sum);
+            m_compensation += other.m_compensation;
+            m_mean += delta * (b / (a + b));
+            m_m2 += other.m_m2 + delta * delta * (a * b / (a + b));
+            m_min = std::min(m_min, other.m_min);
+            m_max = std::max(m_max, other.m_max);
+        }
+
+        std::uint64_t getCount() const { return m_count;}
+        double getSum() const { return m_sum + m_compensation;}
+        // NaN when empty
+        double getMean() const { return m_count ? getSum() / static_cast<double>(m_count) : std::numeric_limits<double>::quiet_NaN();}
+        double getVariance() const { return m_count ? m_m2 / static_cast<double>(m_count) : std::numeric_limits<double>::quiet_NaN();}
+        double getSampleVariance() const { return m_count > 1 ? m_m2 / static_cast<double>(m_count - 1) : std::numeric_limits<double>::quiet_NaN();}
+        double getStdDev() const { return std::sqrt(getVariance());}
+        double getMin() const { return m_min;}
+        double getMax() const { return m_max;}
+
+        friend std::ostream & operator<<(std::ostream & out, const Average & avg){
+            out<<avg.getMean()<<"\n";
+            return out;
+        }
+    };
+
+    // Splits [first, first + n) into one contiguous chunk per thread and merges the partial results
+    // in chunk order: the same thread count always gives the same bits
+    template<typename T>
+    Average parallelAverage(const T * first, std::size_t n, unsigned int threadCount = std::thread::hardware_concurrency()){
+        threadCount = std::max(1u, threadCount);
+        std::vector<Average> partial(threadCount);
+        const std::size_t chunk{ (n + threadCount - 1) / threadCount};
+        auto work{ [&](unsigned int t){
+            const std::size_t start{ std::min(n, t * chunk)};
+            partial[t].add(first + start, std::min(n, start + chunk) - start);
+        }};
+        std::vector<std::thread> workers{};
+        for(unsigned int t{1}; t < threadCount; ++t)
+            workers.emplace_back(work, t);
+        work(0);
+        for(auto & worker : workers)
+            worker.join();
+        Average total{};
+        for(const auto & part : partial)
+            total.merge(part);
+        return total;
+    }
+#endif
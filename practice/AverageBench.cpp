@@ -0,0 +1,133 @@
+/*
+    Average (Average.h): accuracy against a naive double sum / sum of squares and the original
+    int_least8_t-count Average, then throughput of the per-sample, block and parallel paths.
+    Fails if the parallel result drifts from the serial one.
+
+    build: g++ -std=c++17 -O2 -pthread AverageBench.cpp
+    usage: AverageBench [samples] [maxThreads]
+*/
+#include<iostream>
+#include<iomanip>
+#include<vector>
+#include<chrono>
+#include<cmath>
+#include<cstdint>
+#include<thread>
+#include<algorithm>
+#include"Average.h"
+#include"Random.h"
+
+// the original
+class OldAverage{
+    std::int_least32_t m_sum{};
+    std::int_least8_t m_count{};
+public:
+    OldAverage & operator+=(int x){
+        m_count++;
+        m_sum +=x;
+        return *this;
+    }
+    double get() const { return static_cast<double>(m_sum)/m_count;}
+};
+struct Reference{
+    long double mean{};
+    long double variance{};
+};
+// two passes in long double
+Reference reference(const std::vector<double> & data){
+    long double sum{};
+    for(double x : data)
+        sum += x;
+    const long double mean{ sum / data.size()};
+    long double m2{};
+    for(double x : data)
+        m2 += (x - mean) * (x - mean);
+    return { mean, m2 / data.size()};
+}
+double relativeError(double value, long double exact){
+    return static_cast<double>(std::fabs((value - exact) / exact));
+}
+template<typename Func>
+double samplesPerSec(std::size_t count, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+    return count / elapsed.count();
+}
+int main(int argc, char * argv[]){
+    std::size_t samples{ argc > 1 ? std::stoul(argv[1]) : 20'000'000};
+    unsigned int maxThreads{ argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : std::max(1u, std::thread::hardware_concurrency())};
+
+    OldAverage old{};
+    Average streaming{};
+    for(int i{}; i < 200; ++i){
+        old += 10;
+        streaming += 10;
+    }
+    std::cout<<"200 samples of 10: original Average "<<old.get()<<", Average.h "<<streaming.getMean()<<"\n";
+
+    // far from zero: 1e9 + uniform [0, 1)
+    Random rng{ 2021};
+    std::vector<double> data(samples);
+    for(auto & x : data)
+        x = 1e9 + rng.getDouble();
+    const Reference exact{ reference(data)};
+    double naiveSum{}, naiveSquares{};
+    for(double x : data){
+        naiveSum += x;
+        naiveSquares += x * x;
+    }
+    const double naiveMean{ naiveSum / samples};
+    const double naiveVariance{ naiveSquares / samples - naiveMean * naiveMean};
+    Average perSample{};
+    for(double x : data)
+        perSample += x;
+    Average block{};
+    block.add(data.data(), data.size());
+    std::cout<<std::setprecision(3)<<samples<<" samples of 1e9 + U[0,1), relative error vs long double two-pass:\n"
+             <<"  naive sum & sum of squares: mean "<<relativeError(naiveMean, exact.mean)
+             <<", variance "<<relativeError(naiveVariance, exact.variance)<<"\n"
+             <<"  Average += per sample    : mean "<<relativeError(perSample.getMean(), exact.mean)
+             <<", variance "<<relativeError(perSample.getVariance(), exact.variance)<<"\n"
+             <<"  Average::add blocks      : mean "<<relativeError(block.getMean(), exact.mean)
+             <<", variance "<<relativeError(block.getVariance(), exact.variance)<<"\n";
+
+    double sink{};
+    std::cout<<std::setprecision(4)<<"throughput (M samples/sec):\n";
+    double rate{ samplesPerSec(samples, [&]{
+        double sum{};
+        for(double x : data)
+            sum += x;
+        sink += sum;
+    })};
+    std::cout<<"  naive sum          : "<<rate / 1e6<<"\n";
+    rate = samplesPerSec(samples, [&]{
+        Average avg{};
+        for(double x : data)
+            avg += x;
+        sink += avg.getMean();
+    });
+    std::cout<<"  Average += x       : "<<rate / 1e6<<"\n";
+    rate = samplesPerSec(samples, [&]{
+        Average avg{};
+        avg.add(data.data(), data.size());
+        sink += avg.getMean();
+    });
+    std::cout<<"  Average::add       : "<<rate / 1e6<<"\n";
+    bool ok{ true};
+    // doubling, then maxThreads itself when it isn't a power of two
+    for(unsigned int threads{1}; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads * 2){
+        Average parallel{};
+        rate = samplesPerSec(samples, [&]{ parallel = parallelAverage(data.data(), data.size(), threads);});
+        // merge() works from the chunk means; at 1e9 their rounding (1 ulp = 1.2e-7) moves the
+        // variance in the 9th digit with the split, the mean stays put
+        const bool same{ parallel.getCount() == block.getCount() && parallel.getMin() == block.getMin()
+            && parallel.getMax() == block.getMax()
+            && relativeError(parallel.getMean(), block.getMean()) < 1e-15
+            && relativeError(parallel.getVariance(), block.getVariance()) < 1e-7};
+        std::cout<<"  parallelAverage x"<<threads<<": "<<rate / 1e6<<(same ? "" : "  differs from serial!")<<"\n";
+        ok = ok && same;
+    }
+    std::cout<<(sink != 0 ? "" : " ");
+    return ok ? 0 : 1;
+}
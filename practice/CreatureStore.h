@@ -0,0 +1,191 @@
+#ifndef __CREATURESTORE_H
+#define __CREATURESTORE_H
+    /*
+        Entity-component storage for the FightTheMonster actors.
+
+        > Creature/Player/Monster keep name, symbol, health, damage & gold together in one object
+          (with a std::string in the middle), so a pass that only touches health drags every other
+          field through the cache. Here each component lives in its own dense array, a health pass
+          streams over ints only.
+        > Entity handles are stable: (slot index, generation). Destroying an entity swap-removes its
+          components to keep the arrays dense and bumps the slot's generation, so stale handles are
+          detected instead of silently pointing at whoever took the slot.
+        > systems (applyDamage, collectGold, levelUp) are free functions running over whole arrays
+        > CreatureView gives the old Creature/Player interface on top of one entity
+        > a separate batch path: the game loop, the simulator and the replays keep the value-type
+          Creature/Player/Monster; code that runs one pass over many creatures opts into a store
+    */
+    #include<cassert>
+    #include<cstdint>
+    #include<string>
+    #include<string_view>
+    #include<vector>
+
+    struct Entity{
+        std::uint32_t index{};
+        std::uint32_t generation{};
+        friend bool operator==(Entity a, Entity b){ return a.index == b.index && a.generation == b.generation;}
+    };
+
+    class CreatureStore{
+        // dense components, all indexed by the same dense position
+        std::vector<int> m_health{};
+        std::vector<int> m_damage{};
+        std::vector<int> m_gold{};
+        std::vector<int> m_level{};
+        std::vector<char> m_symbol{};
+        std::vector<std::string> m_name{};// cold, only read for display
+        // sparse set: slot -> dense position, dense position -> slot
+        std::vector<std::uint32_t> m_slotToDense{};
+        std::vector<std::uint32_t> m_denseToSlot{};
+        std::vector<std::uint32_t> m_generation{};
+        std::vector<std::uint32_t> m_freeSlots{};
+
+    public:
+        void reserve(std::size_t count){
+            m_health.reserve(count);
+            m_damage.reserve(count);
+            m_gold.reserve(count);
+            m_level.reserve(count);
+            m_symbol.reserve(count);
+            m_name.reserve(count);
+            m_slotToDense.reserve(count);
+            m_denseToSlot.reserve(count);
+            m_generation.reserve(count);
+        }
+        Entity create(std::string_view name, char symbol = ' ', int health = 0, int damage = 0, int gold = 0, int level = 1){
+            std::uint32_t slot{};
+            if(m_freeSlots.empty()){
+                slot = static_cast<std::uint32_t>(m_slotToDense.size());
+                m_slotToDense.push_back(0);
+                m_generation.push_back(0);
+            }else{
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            m_slotToDense[slot] = static_cast<std::uint32_t>(m_denseToSlot.size());
+            m_denseToSlot.push_back(slot);
+            m_health.push_back(health);
+            m_damage.push_back(damage);
+            m_gold.push_back(gold);
+            m_level.push_back(level);
+            m_symbol.push_back(symbol);
+            m_name.emplace_back(name);
+            return { slot, m_generation[slot]};
+        }
+        bool isValid(Entity e) const {
+            return e.index < m_generation.size() && m_generation[e.index] == e.generation;
+        }
+        // swap with the last entity so the arrays stay dense; e's handle becomes stale
+        void destroy(Entity e){
+            assert(isValid(e));
+            const std::uint32_t dense{ m_slotToDense[e.index]};
+            const std::uint32_t last{ static_cast<std::uint32_t>(m_denseToSlot.size() - 1)};
+            if(dense != last){
+                m_health[dense] = m_health[last];
+                m_damage[dense] = m_damage[last];
+                m_gold[dense] = m_gold[last];
+                m_level[dense] = m_level[last];
+                m_symbol[dense] = m_symbol[last];
+                m_name[dense] = std::move(m_name[last]);
+                m_denseToSlot[dense] = m_denseToSlot[last];
+                m_slotToDense[m_denseToSlot[dense]] = dense;
+            }
+            m_health.pop_back();
+            m_damage.pop_back();
+            m_gold.pop_back();
+            m_level.pop_back();
+            m_symbol.pop_back();
+            m_name.pop_back();
+            m_denseToSlot.pop_back();
+            ++m_generation[e.index];
+            m_freeSlots.push_back(e.index);
+        }
+        std::size_t size() const { return m_denseToSlot.size();}
+        std::size_t denseIndex(Entity e) const {
+            assert(isValid(e));
+            return m_slotToDense[e.index];
+        }
+        Entity entityAt(std::size_t dense) const {
+            const std::uint32_t slot{ m_denseToSlot[dense]};
+            return { slot, m_generation[slot]};
+        }
+
+        // component arrays, in dense order
+        std::vector<int> & health(){ return m_health;}
+        std::vector<int> & damage(){ return m_damage;}
+        std::vector<int> & gold(){ return m_gold;}
+        std::vector<int> & level(){ return m_level;}
+        const std::vector<int> & health() const { return m_health;}
+        const std::vector<int> & damage() const { return m_damage;}
+        const std::vector<int> & gold() const { return m_gold;}
+        const std::vector<int> & level() const { return m_level;}
+        const std::vector<char> & symbol() const { return m_symbol;}
+        const std::vector<std::string> & name() const { return m_name;}
+    };
+
+    // Systems: one tight loop per component array, no per-entity calls
+
+    // every creature takes `amount` damage (e.g. a poison tick); returns how many are now dead
+    inline std::size_t applyDamage(CreatureStore & store, int amount){
+        auto & health{ store.health()};
+        std::size_t dead{};
+        for(auto & hp : health){
+            hp -= amount;
+            dead += (hp <= 0);
+        }
+        return dead;
+    }
+    // per-entity damage, amounts[i] for dense position i
+    inline std::size_t applyDamage(CreatureStore & store, const std::vector<int> & amounts){
+        auto & health{ store.health()};
+        assert(amounts.size() == health.size());
+        std::size_t dead{};
+        for(std::size_t i{}; i < health.size(); ++i){
+            health[i] -= amounts[i];
+            dead += (health[i] <= 0);
+        }
+        return dead;
+    }
+    inline void collectGold(CreatureStore & store, const std::vector<int> & amounts){
+        auto & gold{ store.gold()};
+        assert(amounts.size() == gold.size());
+        for(std::size_t i{}; i < gold.size(); ++i)
+            gold[i] += amounts[i];
+    }
+    // levels[i] levels gained by dense position i; like Player::levelUp each level adds one damage
+    inline void levelUp(CreatureStore & store, const std::vector<int> & levels){
+        auto & level{ store.level()};
+        auto & damage{ store.damage()};
+        assert(levels.size() == level.size());
+        for(std::size_t i{}; i < level.size(); ++i){
+            level[i] += levels[i];
+            damage[i] += levels[i];
+        }
+    }
+
+    // The Creature/Player interface as a thin view over one entity of the store
+    class CreatureView{
+        CreatureStore * m_store{};
+        Entity m_entity{};
+        std::size_t idx() const { return m_store->denseIndex(m_entity);}
+    public:
+        CreatureView(CreatureStore & store, Entity entity) : m_store{&store}, m_entity{entity}{}
+        Entity getEntity() const { return m_entity;}
+        const std::string & getName() const { return m_store->name()[idx()];}
+        char getSymbol() const { return m_store->symbol()[idx()];}
+        int getHealth() const { return m_store->health()[idx()];}
+        int getDamage() const { return m_store->damage()[idx()];}
+        int getGold() const { return m_store->gold()[idx()];}
+        int getLevel() const { return m_store->level()[idx()];}
+
+        void reduceHealth(int amt){ m_store->health()[idx()] -= amt;}
+        bool isDead() const { return getHealth() <= 0;}
+        void addGold(int amt){ m_store->gold()[idx()] += amt;}
+        void levelUp(){
+            const auto i{ idx()};
+            ++m_store->level()[i];
+            ++m_store->damage()[i];
+        }
+    };
+#endif
@@ -0,0 +1,90 @@
+/*
+    Damage tick over N creatures: object layout (FightTheMonster.h classes) vs component arrays (CreatureStore.h)
+
+    build: g++ -std=c++17 -O2 CreatureStoreBench.cpp
+    usage: CreatureStoreBench [creatures] [ticks]
+*/
+#include<iostream>
+#include<vector>
+#include<memory>
+#include<chrono>
+#include<string>
+#include<cassert>
+#include"FightTheMonster.h"
+#include"CreatureStore.h"
+
+template<typename Func>
+double nsPerEntity(std::size_t count, int ticks, Func && tick){
+    auto start{ std::chrono::steady_clock::now()};
+    for(int t{}; t < ticks; ++t)
+        tick();
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count() / (static_cast<double>(count) * ticks);
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int ticks{ argc > 2 ? std::stoi(argv[2]) : 100};
+    if(count == 0 || ticks < 1){
+        std::cerr<<"usage: CreatureStoreBench [creatures > 0] [ticks > 0]\n";
+        return 1;
+    }
+    seedRandom(7);
+
+    // same monsters in every layout
+    std::vector<Monster::Type> types(count);
+    for(auto & type : types)
+        type = static_cast<Monster::Type>(getRandomNumber(0, static_cast<int>(Monster::Type::max_types) - 1));
+
+    std::vector<Monster> objects{};
+    std::vector<std::unique_ptr<Monster>> pointers{};
+    CreatureStore store{};
+    objects.reserve(count);
+    pointers.reserve(count);
+    store.reserve(count);
+    for(auto type : types){
+        objects.emplace_back(type);
+        pointers.push_back(std::make_unique<Monster>(type));
+        const Monster & m{ objects.back()};
+        store.create(m.getName(), m.getSymbol(), m.getHealth(), m.getDamage(), m.getGold());
+    }
+    std::cout<<count<<" creatures, "<<ticks<<" damage ticks; sizeof(Monster) = "<<sizeof(Monster)
+             <<" bytes, health component = "<<sizeof(int)<<" bytes\n";
+
+    std::size_t deadObjects{}, deadPointers{}, deadStore{};
+    double objectNs{ nsPerEntity(count, ticks, [&]{
+        deadObjects = 0;
+        for(auto & m : objects){
+            m.reduceHealth(1);
+            deadObjects += m.isDead();
+        }
+    })};
+    double pointerNs{ nsPerEntity(count, ticks, [&]{
+        deadPointers = 0;
+        for(auto & m : pointers){
+            m->reduceHealth(1);
+            deadPointers += m->isDead();
+        }
+    })};
+    double storeNs{ nsPerEntity(count, ticks, [&]{
+        deadStore = applyDamage(store, 1);
+    })};
+    std::cout<<"vector<Monster>             : "<<objectNs<<" ns/entity\n";
+    std::cout<<"vector<unique_ptr<Monster>> : "<<pointerNs<<" ns/entity\n";
+    std::cout<<"CreatureStore::applyDamage  : "<<storeNs<<" ns/entity\n";
+    if(deadObjects != deadStore || deadPointers != deadStore){
+        std::cout<<"dead count mismatch: "<<deadObjects<<" / "<<deadPointers<<" / "<<deadStore<<"\n";
+        return 1;
+    }
+    if(store.size() < 2)// the check below destroys one and keeps another
+        return 0;
+
+    // handles survive removal of other entities, views read the same state as the objects
+    Entity first{ store.entityAt(0)};
+    Entity last{ store.entityAt(store.size() - 1)};
+    store.destroy(first);
+    assert(!store.isValid(first) && store.isValid(last));
+    CreatureView view{ store, last};
+    assert(view.getHealth() == objects.back().getHealth() && view.getName() == objects.back().getName());
+    std::cout<<"last entity after destroying the first: "<<view.getName()<<" ("<<view.getSymbol()<<") health "<<view.getHealth()<<"\n";
+    return 0;
+}
@@ -0,0 +1,133 @@
+#ifndef __ERRORLOG_H
+#define __ERRORLOG_H
+    /*
+        In-process error/event telemetry: a fixed ring buffer of the most recent error events
+        (code, timestamp, thread id, call-site id), dumped to a compact binary file on demand or at exit.
+        Decode the file with ErrorLogDecode.cpp.
+
+        > recording never allocates or locks: one fetch_add claims a slot, three relaxed stores fill it
+          and a release store of the slot's sequence number publishes it
+        > when the ring is full the oldest events are overwritten
+        > the dump checks each slot's sequence before and after reading it and drops slots that a
+          writer was overwriting meanwhile, so it is safe to dump while other threads keep recording
+        > call-site id: 16 bit hash of the file name + 16 bit line number (LOG_ERROR_EVENT fills it in)
+
+        file format (host byte order): "ERRL", u32 version, u32 entry count, then per entry
+            u64 sequence, u64 timestamp (steady clock ns), u32 call site, u16 code, u16 thread
+    */
+    #include<atomic>
+    #include<chrono>
+    #include<cstdint>
+    #include<cstdio>
+    #include<cstdlib>
+    #include<cstring>
+    #include<memory>
+    #include<new>
+    #include<type_traits>
+
+    struct ErrorEvent{
+        std::uint64_t sequence{};// 1-based, in recording order
+        std::uint64_t timestamp{};
+        std::uint32_t callSite{};
+        std::uint16_t code{};
+        std::uint16_t thread{};
+    };
+
+    class ErrorLog{
+        struct Slot{
+            std::atomic<std::uint64_t> sequence{};// 0 = empty, else event sequence number
+            std::atomic<std::uint64_t> timestamp{};
+            std::atomic<std::uint64_t> payload{};// call site | code << 32 | thread << 48
+        };
+        static constexpr std::size_t capacity{ 4096};// power of two
+        Slot m_slots[capacity]{};
+        std::atomic<std::uint64_t> m_next{};
+        std::atomic<std::uint16_t> m_nextThread{};
+        char m_exitPath[256]{};
+
+        std::uint16_t threadId(){
+            thread_local std::uint16_t id{ m_nextThread.fetch_add(1, std::memory_order_relaxed)};
+            return id;
+        }
+    public:
+        static constexpr std::uint32_t version{ 1};
+        static constexpr std::uint64_t entryBytes{ 8 + 8 + 4 + 2 + 2};// one entry in the file
+        static ErrorLog & instance(){
+            static ErrorLog log{};
+            return log;
+        }
+        static constexpr std::uint32_t makeCallSite(const char * file, unsigned int line){
+            std::uint32_t hash{ 2166136261u};// FNV-1a
+            for(; *file; ++file)
+                hash = (hash ^ static_cast<unsigned char>(*file)) * 16777619u;
+            return ((hash ^ (hash >> 16)) << 16) | (line & 0xFFFFu);
+        }
+
+        void record(std::uint16_t code, std::uint32_t callSite){
+            const std::uint64_t sequence{ m_next.fetch_add(1, std::memory_order_relaxed) + 1};
+            Slot & slot{ m_slots[(sequence - 1) & (capacity - 1)]};
+            const auto now{ std::chrono::steady_clock::now().time_since_epoch()};
+            slot.sequence.store(0, std::memory_order_relaxed);// mark as being written
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.timestamp.store(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()),
+                                 std::memory_order_relaxed);
+            slot.payload.store(callSite | (static_cast<std::uint64_t>(code) << 32)
+                               | (static_cast<std::uint64_t>(threadId()) << 48), std::memory_order_relaxed);
+            slot.sequence.store(sequence, std::memory_order_release);
+        }
+        // copies the consistent events, oldest first, into out (room for `max`); returns how many
+        std::size_t snapshot(ErrorEvent * out, std::size_t max) const {
+            const std::uint64_t last{ m_next.load(std::memory_order_acquire)};
+            const std::uint64_t first{ last > capacity ? last - capacity + 1 : 1};
+            std::size_t count{};
+            for(std::uint64_t sequence{ first}; sequence <= last && count < max; ++sequence){
+                const Slot & slot{ m_slots[(sequence - 1) & (capacity - 1)]};
+                if(slot.sequence.load(std::memory_order_acquire) != sequence)
+                    continue;// not yet published or already overwritten
+                const std::uint64_t timestamp{ slot.timestamp.load(std::memory_order_relaxed)};
+                const std::uint64_t payload{ slot.payload.load(std::memory_order_relaxed)};
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if(slot.sequence.load(std::memory_order_relaxed) != sequence)
+                    continue;
+                out[count++] = { sequence, timestamp, static_cast<std::uint32_t>(payload),
+                                 static_cast<std::uint16_t>(payload >> 32), static_cast<std::uint16_t>(payload >> 48)};
+            }
+            return count;
+        }
+        // plain C stdio, so dumping from an atexit handler doesn't depend on iostream teardown.
+        // Each call snapshots into its own heap buffer (96 KiB, too much for some thread stacks),
+        // so concurrent dumps don't overwrite each other's events
+        bool dump(const char * path) const {
+            const std::unique_ptr<ErrorEvent[]> events{ new(std::nothrow) ErrorEvent[capacity]};
+            if(!events)
+                return false;
+            const auto count{ static_cast<std::uint32_t>(snapshot(events.get(), capacity))};
+            std::FILE * file{ std::fopen(path, "wb")};
+            if(!file)
+                return false;
+            bool ok{ std::fwrite("ERRL", 1, 4, file) == 4};
+            ok = ok && std::fwrite(&version, sizeof(version), 1, file) == 1;
+            ok = ok && std::fwrite(&count, sizeof(count), 1, file) == 1;
+            for(std::uint32_t i{}; ok && i < count; ++i){
+                ok = std::fwrite(&events[i].sequence, sizeof(events[i].sequence), 1, file) == 1
+                  && std::fwrite(&events[i].timestamp, sizeof(events[i].timestamp), 1, file) == 1
+                  && std::fwrite(&events[i].callSite, sizeof(events[i].callSite), 1, file) == 1
+                  && std::fwrite(&events[i].code, sizeof(events[i].code), 1, file) == 1
+                  && std::fwrite(&events[i].thread, sizeof(events[i].thread), 1, file) == 1;
+            }
+            return std::fclose(file) == 0 && ok;
+        }
+        void dumpAtExit(const char * path){
+            std::strncpy(m_exitPath, path, sizeof(m_exitPath) - 1);
+            std::atexit([]{ instance().dump(instance().m_exitPath);});
+        }
+        std::uint64_t getRecorded() const { return m_next.load(std::memory_order_relaxed);}
+    };
+
+    inline void recordErrorEvent(std::uint16_t code, std::uint32_t callSite){
+        ErrorLog::instance().record(code, callSite);
+    }
+    // call site hashed at compile time
+    #define LOG_ERROR_EVENT(code) recordErrorEvent(static_cast<std::uint16_t>(code), \
+        std::integral_constant<std::uint32_t, ErrorLog::makeCallSite(__FILE__, __LINE__)>::value)
+#endif
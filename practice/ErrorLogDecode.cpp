@@ -0,0 +1,57 @@
+/*
+    Decoder for the binary error event dumps written by ErrorLog (ErrorLog.h)
+
+    build: g++ -std=c++17 ErrorLogDecode.cpp
+    usage: ErrorLogDecode [errors.bin]
+*/
+#include<iostream>
+#include<fstream>
+#include<cstring>
+#include<vector>
+#include"ErrorLog.h"
+#include"ArrayInt.h"
+
+int main(int argc, char * argv[]){
+    const char * path{ argc > 1 ? argv[1] : "errors.bin"};
+    std::ifstream in{ path, std::ios::binary | std::ios::ate};
+    const std::streamoff fileSize{ in.tellg()};
+    in.seekg(0);
+    auto get{ [&in](auto & field){ in.read(reinterpret_cast<char *>(&field), sizeof(field));}};
+    char magic[4]{};
+    std::uint32_t version{};
+    std::uint32_t count{};
+    in.read(magic, sizeof(magic));
+    get(version);
+    get(count);
+    if(!in || std::memcmp(magic, "ERRL", 4) != 0 || version != ErrorLog::version){
+        std::cerr<<path<<" is not an error log dump (version "<<ErrorLog::version<<")\n";
+        return 1;
+    }
+    // the count comes from the file: check it against the bytes left before allocating
+    if(count > static_cast<std::uint64_t>(fileSize - static_cast<std::streamoff>(in.tellg())) / ErrorLog::entryBytes){
+        std::cerr<<path<<" is truncated\n";
+        return 1;
+    }
+    std::vector<ErrorEvent> events(count);
+    for(auto & event : events){
+        get(event.sequence);
+        get(event.timestamp);
+        get(event.callSite);
+        get(event.code);
+        get(event.thread);
+    }
+    if(!in){
+        std::cerr<<path<<" is truncated\n";
+        return 1;
+    }
+    std::cout<<count<<" events\n";
+    for(const auto & event : events){
+        std::cout<<"#"<<event.sequence<<" +"<<(event.timestamp - events.front().timestamp) / 1000.0<<" us"
+                 <<" thread "<<event.thread<<" site "<<std::hex<<(event.callSite >> 16)<<std::dec
+                 <<":"<<(event.callSite & 0xFFFFu)<<" code "<<event.code;
+        if(event.code < static_cast<std::uint16_t>(ArrayError::max_errors))
+            std::cout<<" ("<<getErrorString(static_cast<ArrayError>(event.code))<<")";
+        std::cout<<"\n";
+    }
+    return 0;
+}
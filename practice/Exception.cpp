@@ -1,43 +1,26 @@
 #include<iostream>
-#include<exception>
-#include<string>
-#include<string_view>
-class ArrayException : public std::exception{
-    std::string m_error{};
-public: 
-    ArrayException(std::string_view error)
-    :m_error{error}{}
-    const char *what() const noexcept override{
-        return m_error.c_str();
-    }
-};
-class ArrayInt{
-    int m_data[3]{};
-    int m_size{};
-public:
-    ArrayInt():m_size(3){
-    };
-    int getLength(){ return 3;}
-    int & operator[](int idx){
-        if(idx < 0 || idx >m_size){
-           // throw std::length_error("Invalid array index access");
-           throw ArrayException{"Invalid index"};
-        }
-        return m_data[idx];
-    }
-    ~ArrayInt(){ }  
-};
+#include"ArrayInt.h"
+#include"ErrorLog.h"
 
 int main(){
+    ErrorLog::instance().dumpAtExit("errors.bin");// decode with ErrorLogDecode
     ArrayInt array;
     try{
         int value{array[5]};
     }
     catch(const ArrayException & exception){
+        LOG_ERROR_EVENT(exception.getCode());
         std::cerr<<"An array exception occured ("<<exception.what()<<")\n";
     }
     catch(const std::exception & exception){
         std::cerr<<"Some other exception ocuured ("<<exception.what()<<")\n";
     }
+    // same access without exceptions: the error comes back as a value
+    if(auto value{ array.try_at(5)}; !value){
+        LOG_ERROR_EVENT(value.error());
+        std::cerr<<"try_at failed ("<<getErrorString(value.error())<<")\n";
+    }
+    array.try_at(1).value() = 7;
+    std::cout<<"array[1] = "<<array.try_at(1).value_or(-1)<<"\n";
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*
+    ArrayInt access: throwing operator[] vs Expected returning try_at() vs unchecked access
+    (with the bounds check done by the caller), under a success-heavy and an error-heavy load.
+    Also the cost of recording an error event into ErrorLog, from 1 and several threads.
+
+    build: g++ -std=c++17 -O2 -pthread ExceptionBench.cpp
+           g++ -std=c++17 -O2 -pthread -fno-exceptions ExceptionBench.cpp
+           (no exceptions: only the try_at() and unchecked rows, checks ArrayInt.h builds without them)
+    usage: ExceptionBench [accesses]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<string>
+#include"ArrayInt.h"
+#include"Random.h"
+#include"ErrorLog.h"
+#include<thread>
+
+struct Result{
+    long long sum{};
+    long long errors{};
+};
+template<typename Access>
+void run(std::string_view label, const std::vector<int> & indices, Access && access){
+    auto start{ std::chrono::steady_clock::now()};
+    Result result{ access(indices)};
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    std::cout<<"  "<<label<<elapsed.count() / indices.size()<<" ns/access (sum "<<result.sum
+             <<", errors "<<result.errors<<")\n";
+}
+void benchErrorLog(std::size_t count){
+    for(unsigned int threads{1}; threads <= 4; threads *= 2){
+        const std::size_t perThread{ count / threads};
+        auto start{ std::chrono::steady_clock::now()};
+        std::vector<std::thread> workers{};
+        for(unsigned int t{}; t < threads; ++t){
+            workers.emplace_back([perThread]{
+                for(std::size_t i{}; i < perThread; ++i)
+                    LOG_ERROR_EVENT(i & 1);
+            });
+        }
+        for(auto & worker : workers)
+            worker.join();
+        std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+        std::cout<<"  "<<threads<<" thread(s): "<<elapsed.count() / perThread<<" ns/event per thread\n";
+    }
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 10'000'000};
+    ArrayInt array{};
+    for(int i{}; i < array.getLength(); ++i)
+        *array.try_at(i) = i + 1;
+    const int length{ array.getLength()};
+
+    Random rng{ 5};
+    for(int errorPercent : { 0, 1, 50}){
+        std::vector<int> indices(count);
+        for(auto & idx : indices)
+            idx = rng.getInt(0, 99) < errorPercent ? rng.getInt(length, 2 * length) : rng.getInt(0, length - 1);
+        std::cout<<errorPercent<<"% invalid indices\n";
+
+#if __cpp_exceptions
+        run("throw    : ", indices, [&](const std::vector<int> & idx){
+            Result r{};
+            for(int i : idx){
+                try{
+                    r.sum += array[i];
+                }
+                catch(const ArrayException &){
+                    ++r.errors;
+                }
+            }
+            return r;
+        });
+#endif
+        run("expected : ", indices, [&](const std::vector<int> & idx){
+            Result r{};
+            for(int i : idx){
+                if(auto value{ array.try_at(i)})
+                    r.sum += *value;
+                else
+                    ++r.errors;
+            }
+            return r;
+        });
+        run("unchecked: ", indices, [&](const std::vector<int> & idx){
+            Result r{};
+            for(int i : idx){
+                if(i >= 0 && i < length)
+                    r.sum += array.uncheckedAt(i);
+                else
+                    ++r.errors;
+            }
+            return r;
+        });
+    }
+    std::cout<<"ErrorLog record\n";
+    benchErrorLog(count);
+    return 0;
+}
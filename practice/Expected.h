@@ -0,0 +1,57 @@
+#ifndef __EXPECTED_H
+#define __EXPECTED_H
+    /*
+        Minimal C++17 stand-in for C++23 std::expected<T, E>: either a value or an error code,
+        returned instead of thrown. Member names follow std::expected so it can be swapped later.
+        > no allocation, no exception machinery; value() on an error is a programming bug (assert)
+        > Expected<T&, E> holds a pointer, so element access can return a reference
+    */
+    #include<cassert>
+    #include<type_traits>
+    #include<utility>
+    #include<variant>
+
+    template<typename E>
+    struct Unexpected{
+        E error{};
+    };
+    template<typename E>
+    constexpr Unexpected<E> unexpected(E error){ return { error};}
+
+    template<typename T, typename E>
+    class [[nodiscard]] Expected{
+        std::variant<T, E> m_data;
+    public:
+        constexpr Expected(const T & value) : m_data{ std::in_place_index<0>, value}{}
+        constexpr Expected(T && value) : m_data{ std::in_place_index<0>, std::move(value)}{}
+        constexpr Expected(Unexpected<E> error) : m_data{ std::in_place_index<1>, error.error}{}
+
+        constexpr bool has_value() const noexcept { return m_data.index() == 0;}
+        constexpr explicit operator bool() const noexcept { return has_value();}
+        constexpr T & value() & { assert(has_value()); return *std::get_if<0>(&m_data);}
+        constexpr const T & value() const & { assert(has_value()); return *std::get_if<0>(&m_data);}
+        constexpr T & operator*() & { return value();}
+        constexpr const T & operator*() const & { return value();}
+        constexpr T * operator->() { return &value();}
+        constexpr const T * operator->() const { return &value();}
+        constexpr E error() const { assert(!has_value()); return *std::get_if<1>(&m_data);}
+        constexpr T value_or(T fallback) const { return has_value() ? value() : fallback;}
+    };
+
+    template<typename T, typename E>
+    class [[nodiscard]] Expected<T &, E>{
+        T * m_value{ nullptr};
+        E m_error{};
+    public:
+        constexpr Expected(T & value) noexcept : m_value{ &value}{}
+        constexpr Expected(Unexpected<E> error) noexcept : m_error{ error.error}{}
+
+        constexpr bool has_value() const noexcept { return m_value != nullptr;}
+        constexpr explicit operator bool() const noexcept { return has_value();}
+        constexpr T & value() const { assert(has_value()); return *m_value;}
+        constexpr T & operator*() const { return value();}
+        constexpr T * operator->() const { return &value();}
+        constexpr E error() const { assert(!has_value()); return m_error;}
+        constexpr std::remove_const_t<T> value_or(std::remove_const_t<T> fallback) const { return has_value() ? *m_value : fallback;}
+    };
+#endif
@@ -0,0 +1,127 @@
+/*
+    Replays sessions recorded by InheritanceFightTheMonster (fight.replay) and measures snapshot cost.
+
+    build: g++ -std=c++17 -O2 FightReplay.cpp
+    usage: FightReplay <file> [turn]     print the state right before `turn` (default: end of session)
+           FightReplay bench [turns]    long endless run: recording overhead, snapshot size & seek latency per K
+*/
+#include<iostream>
+#include<string>
+#include<vector>
+#include<chrono>
+#include<algorithm>
+#include<stdexcept>
+#include"FightReplay.h"
+
+void printState(const FightSession & session){
+    const Player & player{ session.getPlayer()};
+    std::cout<<"turn "<<session.getTurn()<<": "<<player.getName()<<" level "<<player.getLevel()
+             <<", health "<<player.getHealth()<<", damage "<<player.getDamage()<<", gold "<<player.getGold();
+    if(session.inEncounter())
+        std::cout<<"; fighting a "<<session.getMonster().getName()<<" with "<<session.getMonster().getHealth()<<" health";
+    std::cout<<"\n";
+}
+// a whole decimal count; false for anything std::stoull rejects, a sign or trailing characters
+bool parseCount(const char * arg, std::uint64_t & value){
+    try{
+        std::size_t used{};
+        value = std::stoull(arg, &used);
+        return arg[0] != '-' && arg[0] != '+' && arg[used] == '\0';
+    }catch(const std::logic_error &){// invalid_argument, out_of_range
+        return false;
+    }
+}
+int replayFile(const std::string & path, const char * turnArg){
+    std::uint64_t turn{};
+    if(turnArg && !parseCount(turnArg, turn)){
+        std::cerr<<"usage: FightReplay <file> [turn >= 0]\n";
+        return 1;
+    }
+    FightRecording recording{};
+    if(!recording.load(path)){
+        std::cerr<<"cannot read replay "<<path<<"\n";
+        return 1;
+    }
+    turn = turnArg ? std::min(turn, recording.getTurns()) : recording.getTurns();
+    std::cout<<path<<": seed "<<recording.getSeed()<<", "<<recording.getTurns()<<" turns\n";
+    printState(recording.seek(turn));
+    return 0;
+}
+
+int bench(std::uint64_t turns){
+    constexpr std::uint64_t seed{ 99};
+    // answers come from their own generator so they never disturb the game's stream
+    Random answers{ 12345};
+    std::vector<Action> inputs(turns);
+    for(auto & input : inputs)
+        input = answers.getInt(0, 3) == 0 ? Action::run : Action::fight;
+
+    // reference run without recording; keep the exact state at a few turns to check seeks against
+    std::vector<std::uint64_t> checkTurns{};
+    for(std::uint64_t t{}; t < turns; t += turns / 97 + 1)
+        checkTurns.push_back(t);
+    std::vector<std::array<unsigned char, FightSnapshot::byteSize>> expected{};
+    seedRandom(seed);
+    FightSession reference{ "bench", true};
+    auto start{ std::chrono::steady_clock::now()};
+    for(std::uint64_t t{}, next{}; t < turns; ++t){
+        if(next < checkTurns.size() && checkTurns[next] == t){
+            expected.push_back(reference.snapshot().bytes());
+            ++next;
+        }
+        reference.step(inputs[t]);
+    }
+    std::chrono::duration<double, std::nano> plain{ std::chrono::steady_clock::now() - start};
+    std::cout<<turns<<" turns ("<<reference.getLifetimes()<<" player lifetimes), "
+             <<plain.count() / turns<<" ns/turn unrecorded\n";
+
+    for(std::uint32_t interval : { 16u, 64u, 256u, 1024u, 4096u}){
+        seedRandom(seed);
+        FightSession session{ "bench", true};
+        FightRecording recording{ seed, "bench", interval, true};
+        start = std::chrono::steady_clock::now();
+        for(std::uint64_t t{}; t < turns; ++t){
+            recording.record(session, inputs[t]);
+            session.step(inputs[t]);
+        }
+        std::chrono::duration<double, std::nano> recorded{ std::chrono::steady_clock::now() - start};
+
+        bool ok{ true};
+        for(std::size_t i{}; i < checkTurns.size(); ++i)
+            ok = ok && recording.seek(checkTurns[i]).snapshot().bytes() == expected[i];
+
+        Random pick{ interval};
+        constexpr int seeks{ 2000};
+        double worst{};
+        start = std::chrono::steady_clock::now();
+        for(int i{}; i < seeks; ++i){
+            auto seekStart{ std::chrono::steady_clock::now()};
+            FightSession at{ recording.seek(pick.next() % turns)};
+            std::chrono::duration<double, std::micro> one{ std::chrono::steady_clock::now() - seekStart};
+            worst = std::max(worst, one.count());
+        }
+        std::chrono::duration<double, std::micro> seekTime{ std::chrono::steady_clock::now() - start};
+        std::cout<<"K = "<<interval<<": record "<<recorded.count() / turns<<" ns/turn, snapshots "
+                 <<recording.snapshotBytes() / 1024.0<<" KiB + inputs "<<recording.inputBytes() / 1024.0
+                 <<" KiB, seek avg "<<seekTime.count() / seeks<<" us (max "<<worst<<" us)"
+                 <<(ok ? "" : "  SEEK MISMATCH")<<"\n";
+        if(!ok)
+            return 1;
+    }
+    return 0;
+}
+int main(int argc, char * argv[]){
+    if(argc > 1 && std::string_view{argv[1]} == "bench"){
+        std::uint64_t turns{ 10'000'000};
+        if(argc > 2 && (!parseCount(argv[2], turns) || turns == 0)){
+            std::cerr<<"usage: FightReplay bench [turns > 0]\n";
+            return 1;
+        }
+        return bench(turns);
+    }
+    if(argc < 2){
+        std::cerr<<"usage: FightReplay <file> [turn] | FightReplay bench [turns]\n";
+        return 1;
+    }
+    return replayFile(argv[1], argc > 2 ? argv[2] : nullptr);
+}
@@ -0,0 +1,248 @@
+#ifndef __FIGHTREPLAY_H
+#define __FIGHTREPLAY_H
+    /*
+        Deterministic replay of a FightTheMonster session, with snapshots to jump to any turn.
+
+        > a turn is one "(R)un or (F)ight" answer. Given the state before a turn (player, current
+          monster, random generator) and the answer, the rest is fixed, so a session is
+          seed + player name + one input bit per turn.
+        > every K turns the recording also keeps a FightSnapshot: a fixed 50 byte binary image of the
+          player, the monster being fought and the thread's Random state.
+          seek(turn) restores the nearest snapshot at or before `turn` and re-simulates at most K-1 turns.
+        > FightSession is the game loop of InheritanceFightTheMonster.cpp turned inside out: step(action)
+          instead of reading std::cin, no output. It draws from the calling thread's generator.
+        > binary files are written in host byte order
+    */
+    #include<algorithm>
+    #include<array>
+    #include<cstdint>
+    #include<cstring>
+    #include<fstream>
+    #include<string>
+    #include<string_view>
+    #include<vector>
+    #include"FightTheMonster.h"
+
+    struct FightSnapshot{
+        static constexpr std::size_t byteSize{ 50};
+        std::uint64_t turn{};
+        std::uint32_t lifetimes{};
+        std::int32_t health{};
+        std::int32_t damage{};
+        std::int32_t gold{};
+        std::int32_t level{};
+        std::uint8_t inEncounter{};
+        std::uint8_t monsterType{};
+        std::int32_t monsterHealth{};
+        std::uint64_t rngState{};
+        std::uint64_t rngGamma{};
+
+        static FightSnapshot capture(std::uint64_t turn, std::uint32_t lifetimes, const Player & player,
+                                     const Monster & monster, bool inEncounter){
+            const Random & rng{ threadRandom()};
+            return { turn, lifetimes, player.getHealth(), player.getDamage(), player.getGold(), player.getLevel(),
+                     inEncounter, static_cast<std::uint8_t>(monster.getType()), monster.getHealth(),
+                     rng.getState(), rng.getGamma()};
+        }
+        void write(unsigned char * out) const {
+            auto put{ [&out](const auto & field){
+                std::memcpy(out, &field, sizeof(field));
+                out += sizeof(field);
+            }};
+            put(turn); put(lifetimes); put(health); put(damage); put(gold); put(level);
+            put(inEncounter); put(monsterType); put(monsterHealth); put(rngState); put(rngGamma);
+        }
+        static FightSnapshot read(const unsigned char * in){
+            FightSnapshot s{};
+            auto get{ [&in](auto & field){
+                std::memcpy(&field, in, sizeof(field));
+                in += sizeof(field);
+            }};
+            get(s.turn); get(s.lifetimes); get(s.health); get(s.damage); get(s.gold); get(s.level);
+            get(s.inEncounter); get(s.monsterType); get(s.monsterHealth); get(s.rngState); get(s.rngGamma);
+            return s;
+        }
+        std::array<unsigned char, byteSize> bytes() const {
+            std::array<unsigned char, byteSize> out{};
+            write(out.data());
+            return out;
+        }
+    };
+
+    class FightSession{
+        std::string m_name{};
+        Player m_player;
+        Monster m_monster{ Monster::Type::slime};
+        bool m_inEncounter{ false};
+        bool m_respawn{ false};// endless mode: a finished player starts over (long benchmark runs)
+        std::uint64_t m_turn{};
+        std::uint32_t m_lifetimes{};
+    public:
+        FightSession(std::string_view name, bool respawn = false)
+            : m_name{name}, m_player{name}, m_respawn{respawn}{}
+        FightSession(std::string_view name, bool respawn, const FightSnapshot & snapshot)
+            : m_name{name}, m_player{name}, m_respawn{respawn}{
+            restore(snapshot);
+        }
+        const Player & getPlayer() const { return m_player;}
+        const Monster & getMonster() const { return m_monster;}
+        bool inEncounter() const { return m_inEncounter;}
+        std::uint64_t getTurn() const { return m_turn;}
+        std::uint32_t getLifetimes() const { return m_lifetimes;}
+        bool isOver() const { return !m_respawn && (m_player.isDead() || m_player.hasWon());}
+
+        // same order of random draws as fightMonster(): spawn on the first answer of an encounter,
+        // then flee roll or player hit followed by monster hit
+        void step(Action action){
+            if(!m_inEncounter){
+                m_monster = Monster::getRandomMonster();
+                m_inEncounter = true;
+            }
+            if(action == Action::run){
+                if(tryFlee())
+                    m_inEncounter = false;
+                else
+                    strikePlayer(m_player, m_monster);
+            }else{
+                strikeMonster(m_player, m_monster);
+                strikePlayer(m_player, m_monster);
+            }
+            if(m_monster.isDead())
+                m_inEncounter = false;
+            if(m_player.isDead() || m_player.hasWon()){
+                m_inEncounter = false;
+                if(m_respawn){
+                    m_player = Player{ m_name};
+                    ++m_lifetimes;
+                }
+            }
+            ++m_turn;
+        }
+        FightSnapshot snapshot() const {
+            return FightSnapshot::capture(m_turn, m_lifetimes, m_player, m_monster, m_inEncounter);
+        }
+        // also puts the calling thread's generator back where it was
+        void restore(const FightSnapshot & s){
+            m_turn = s.turn;
+            m_lifetimes = s.lifetimes;
+            m_player = Player{ m_name, s.health, s.damage, s.gold, s.level};
+            m_monster = Monster{ static_cast<Monster::Type>(s.monsterType), s.monsterHealth};
+            m_inEncounter = s.inEncounter;
+            threadRandom() = Random{ s.rngState, s.rngGamma};
+        }
+    };
+
+    class FightRecording{
+        std::uint64_t m_seed{};
+        std::string m_name{};
+        std::uint32_t m_interval{ 64};
+        bool m_respawn{ false};
+        std::uint64_t m_turns{};
+        std::vector<std::uint8_t> m_inputs{};// one bit per turn, 1 = run
+        std::vector<unsigned char> m_snapshots{};// snapshot n = state before turn n * interval
+        static constexpr char magic[4]{ 'F', 'R', 'P', 'L'};
+    public:
+        FightRecording() = default;
+        FightRecording(std::uint64_t seed, std::string_view name, std::uint32_t interval, bool respawn = false)
+            : m_seed{seed}, m_name{name}, m_interval{interval ? interval : 1}, m_respawn{respawn}{}
+
+        std::uint64_t getSeed() const { return m_seed;}
+        const std::string & getName() const { return m_name;}
+        std::uint64_t getTurns() const { return m_turns;}
+        std::uint32_t getInterval() const { return m_interval;}
+        std::size_t inputBytes() const { return m_inputs.size();}
+        std::size_t snapshotBytes() const { return m_snapshots.size();}
+
+        // call before each turn is played: first the snapshot when one is due, then the answer
+        bool needsSnapshot() const { return m_turns % m_interval == 0;}
+        void addSnapshot(const FightSnapshot & snapshot){
+            auto bytes{ snapshot.bytes()};
+            m_snapshots.insert(m_snapshots.end(), bytes.begin(), bytes.end());
+        }
+        void addInput(Action action){
+            if(m_turns % 8 == 0)
+                m_inputs.push_back(0);
+            if(action == Action::run)
+                m_inputs.back() |= static_cast<std::uint8_t>(1u << (m_turns % 8));
+            ++m_turns;
+        }
+        void record(const FightSession & session, Action action){
+            if(needsSnapshot())
+                addSnapshot(session.snapshot());
+            addInput(action);
+        }
+        Action getInput(std::uint64_t turn) const {
+            return (m_inputs[turn / 8] >> (turn % 8)) & 1u ? Action::run : Action::fight;
+        }
+        // session as it was right before `turn` was played (turn == getTurns() gives the final state)
+        FightSession seek(std::uint64_t turn) const {
+            turn = std::min(turn, m_turns);// no inputs past the end of the session
+            if(m_snapshots.empty()){// nothing played yet
+                seedRandom(m_seed);
+                return { m_name, m_respawn};
+            }
+            const std::uint64_t index{ std::min(turn, m_turns ? m_turns - 1 : 0) / m_interval};
+            FightSession session{ m_name, m_respawn,
+                FightSnapshot::read(m_snapshots.data() + index * FightSnapshot::byteSize)};
+            for(std::uint64_t t{ index * m_interval}; t < turn; ++t)
+                session.step(getInput(t));
+            return session;
+        }
+
+        bool save(const std::string & path) const {
+            std::ofstream out{ path, std::ios::binary};
+            auto put{ [&out](const auto & field){ out.write(reinterpret_cast<const char *>(&field), sizeof(field));}};
+            out.write(magic, sizeof(magic));
+            put(m_seed); put(m_interval); put(static_cast<std::uint8_t>(m_respawn)); put(m_turns);
+            put(static_cast<std::uint32_t>(m_name.size()));
+            out.write(m_name.data(), static_cast<std::streamsize>(m_name.size()));
+            out.write(reinterpret_cast<const char *>(m_inputs.data()), static_cast<std::streamsize>(m_inputs.size()));
+            put(static_cast<std::uint64_t>(m_snapshots.size()));
+            out.write(reinterpret_cast<const char *>(m_snapshots.data()), static_cast<std::streamsize>(m_snapshots.size()));
+            return static_cast<bool>(out);
+        }
+        // false for a file that isn't a replay, or whose counts don't fit its size (nothing is
+        // allocated from a count before it is checked); *this is only changed on success
+        bool load(const std::string & path){
+            std::ifstream in{ path, std::ios::binary | std::ios::ate};
+            if(!in)
+                return false;
+            const std::streamoff fileSize{ in.tellg()};
+            in.seekg(0);
+            auto get{ [&in](auto & field){ in.read(reinterpret_cast<char *>(&field), sizeof(field));}};
+            auto left{ [&in, fileSize]{ return static_cast<std::uint64_t>(fileSize - static_cast<std::streamoff>(in.tellg()));}};
+            char fileMagic[4]{};
+            in.read(fileMagic, sizeof(fileMagic));
+            if(!in || std::memcmp(fileMagic, magic, sizeof(magic)) != 0)
+                return false;
+            std::uint64_t seed{}, turns{}, snapshotSize{};
+            std::uint32_t interval{}, nameSize{};
+            std::uint8_t respawn{};
+            get(seed); get(interval); get(respawn); get(turns); get(nameSize);
+            if(!in || interval == 0 || nameSize > left())
+                return false;
+            std::string name(nameSize, '\0');
+            in.read(name.data(), nameSize);
+            if(!in || turns / 8 >= left())
+                return false;
+            std::vector<std::uint8_t> inputs(turns / 8 + (turns % 8 != 0));
+            in.read(reinterpret_cast<char *>(inputs.data()), static_cast<std::streamsize>(inputs.size()));
+            get(snapshotSize);
+            const std::uint64_t snapshots{ turns / interval + (turns % interval != 0)};
+            if(!in || snapshotSize > left() || snapshotSize != snapshots * FightSnapshot::byteSize)
+                return false;
+            std::vector<unsigned char> snapshotBytes(snapshotSize);
+            in.read(reinterpret_cast<char *>(snapshotBytes.data()), static_cast<std::streamsize>(snapshotSize));
+            if(!in)
+                return false;
+            m_seed = seed;
+            m_name = std::move(name);
+            m_interval = interval;
+            m_respawn = respawn;
+            m_turns = turns;
+            m_inputs = std::move(inputs);
+            m_snapshots = std::move(snapshotBytes);
+            return true;
+        }
+    };
+#endif
@@ -0,0 +1,189 @@
+/*
+    Headless simulator for InheritanceFightTheMonster: plays millions of automated player lifetimes
+    with a decision policy instead of "(R)un or (F)ight" from std::cin, and aggregates the outcomes
+    (level reached, gold, what killed the player) for game balancing.
+
+    > no I/O on the hot path: the fight loop only uses the rules in FightTheMonster.h
+    > lifetime i always runs on stream i of the seed (seedThreadRandom), so the aggregate is the same
+      whatever the thread count
+    > each thread accumulates its own SimStats, merged once at the end
+
+    build: g++ -std=c++17 -O2 -pthread FightSimulator.cpp
+    usage: FightSimulator [lifetimes] [maxThreads] [seed]
+*/
+#include<iostream>
+#include<string>
+#include<array>
+#include<vector>
+#include<thread>
+#include<chrono>
+#include<algorithm>
+#include<functional>
+#include<cstdint>
+#include"FightTheMonster.h"
+
+// Decision policies: called once per round with the current state, return what the player does
+struct AlwaysFight{
+    Action operator()(const Player &, const Monster &) const { return Action::fight;}
+};
+struct FleeBelowHealth{
+    int threshold{};
+    Action operator()(const Player & player, const Monster &) const {
+        return player.getHealth() < threshold ? Action::run : Action::fight;
+    }
+};
+// run when the monster would kill us before we kill it
+struct FleeWhenOutmatched{
+    Action operator()(const Player & player, const Monster & monster) const {
+        int hitsToKill{ (monster.getHealth() + player.getDamage() - 1) / player.getDamage()};
+        int hitsToDie{ (player.getHealth() + monster.getDamage() - 1) / monster.getDamage()};
+        return hitsToDie <= hitsToKill ? Action::run : Action::fight;
+    }
+};
+
+struct LifetimeResult{
+    int level{};
+    int gold{};
+    bool won{};
+    Monster::Type killedBy{ Monster::Type::max_types};// max_types when won
+};
+
+struct SimStats{
+    static constexpr std::size_t maxLevel{ 20};
+    std::uint64_t runs{};
+    std::uint64_t wins{};
+    std::uint64_t totalGold{};
+    int maxGold{};
+    std::array<std::uint64_t, maxLevel + 1> levelCount{};
+    std::array<std::uint64_t, static_cast<std::size_t>(Monster::Type::max_types)> deathsBy{};
+
+    void add(const LifetimeResult & result){
+        ++runs;
+        totalGold += static_cast<std::uint64_t>(result.gold);
+        maxGold = std::max(maxGold, result.gold);
+        ++levelCount[std::min(static_cast<std::size_t>(result.level), maxLevel)];
+        if(result.won)
+            ++wins;
+        else
+            ++deathsBy[static_cast<std::size_t>(result.killedBy)];
+    }
+    void merge(const SimStats & other){
+        runs += other.runs;
+        wins += other.wins;
+        totalGold += other.totalGold;
+        maxGold = std::max(maxGold, other.maxGold);
+        for(std::size_t i{}; i < levelCount.size(); ++i)
+            levelCount[i] += other.levelCount[i];
+        for(std::size_t i{}; i < deathsBy.size(); ++i)
+            deathsBy[i] += other.deathsBy[i];
+    }
+    bool operator==(const SimStats & other) const {
+        return runs == other.runs && wins == other.wins && totalGold == other.totalGold
+            && maxGold == other.maxGold && levelCount == other.levelCount && deathsBy == other.deathsBy;
+    }
+};
+
+// same flow as fightMonster() in InheritanceFightTheMonster.cpp, minus the I/O
+template<typename Policy>
+void fightMonsterHeadless(Player & player, const Policy & policy, Monster::Type & lastFoe){
+    Monster m{ Monster::getRandomMonster() };
+    lastFoe = m.getType();
+    while(!player.isDead() && !m.isDead()){
+        if(policy(player, m) == Action::run){
+            if(tryFlee())
+                return;
+            strikePlayer(player, m);// failure to flee gives the monster a free attack
+            continue;
+        }
+        strikeMonster(player, m);
+        strikePlayer(player, m);
+    }
+}
+template<typename Policy>
+LifetimeResult simulateLifetime(const Policy & policy){
+    Player player{ "sim"};
+    Monster::Type lastFoe{ Monster::Type::max_types};
+    while(!(player.isDead() || player.hasWon()))
+        fightMonsterHeadless(player, policy, lastFoe);
+    bool won{ player.hasWon()};
+    return { player.getLevel(), player.getGold(), won, won ? Monster::Type::max_types : lastFoe};
+}
+// runs lifetimes [0, lifetimes) over threadCount threads, lifetime i on random stream i
+template<typename Policy>
+SimStats simulate(const Policy & policy, std::uint64_t lifetimes, std::uint64_t seed, unsigned int threadCount){
+    std::vector<SimStats> partial(threadCount);
+    auto work{ [&](unsigned int t){
+        const std::uint64_t chunk{ (lifetimes + threadCount - 1) / threadCount};
+        const std::uint64_t last{ std::min(lifetimes, (t + 1) * chunk)};
+        SimStats local{};
+        for(std::uint64_t i{ t * chunk}; i < last; ++i){
+            seedThreadRandom(seed, i);
+            local.add(simulateLifetime(policy));
+        }
+        partial[t] = local;
+    }};
+    std::vector<std::thread> workers{};
+    for(unsigned int t{1}; t < threadCount; ++t)
+        workers.emplace_back(work, t);
+    work(0);
+    for(auto & worker : workers)
+        worker.join();
+    SimStats total{};
+    for(const auto & stats : partial)
+        total.merge(stats);
+    return total;
+}
+
+std::string_view getTypeString(Monster::Type type){
+    switch(type){
+        case Monster::Type::dragon: return "dragon";
+        case Monster::Type::orc:    return "orc";
+        case Monster::Type::slime:  return "slime";
+        default: return "?";
+    }
+}
+void printStats(const SimStats & stats){
+    std::cout<<"  won "<<100.0 * stats.wins / stats.runs<<"%, avg gold "<<static_cast<double>(stats.totalGold) / stats.runs
+             <<", max gold "<<stats.maxGold<<"\n  deaths by:";
+    for(std::size_t i{}; i < stats.deathsBy.size(); ++i)
+        std::cout<<" "<<getTypeString(static_cast<Monster::Type>(i))<<" "<<100.0 * stats.deathsBy[i] / stats.runs<<"%";
+    std::cout<<"\n  level reached:";
+    for(std::size_t level{1}; level < stats.levelCount.size(); ++level)
+        if(stats.levelCount[level])
+            std::cout<<" "<<level<<":"<<stats.levelCount[level];
+    std::cout<<"\n";
+}
+template<typename Policy>
+bool runPolicy(std::string_view name, const Policy & policy, std::uint64_t lifetimes, unsigned int maxThreads, std::uint64_t seed){
+    std::cout<<name<<"\n";
+    SimStats reference{};
+    double baseRate{};
+    // doubling, then maxThreads itself when it isn't a power of two
+    for(unsigned int threads{1}; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads * 2){
+        auto start{ std::chrono::steady_clock::now()};
+        SimStats stats{ simulate(policy, lifetimes, seed, threads)};
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+        double rate{ lifetimes / elapsed.count()};
+        if(threads == 1){
+            reference = stats;
+            baseRate = rate;
+            printStats(stats);
+        }
+        std::cout<<"  "<<threads<<" thread(s): "<<rate / 1e6<<" M lifetimes/sec, scaling x"<<rate / baseRate<<"\n";
+        if(!(stats == reference)){
+            std::cout<<"  results differ from the 1 thread run!\n";
+            return false;
+        }
+    }
+    return true;
+}
+int main(int argc, char * argv[]){
+    std::uint64_t lifetimes{ argc > 1 ? std::stoull(argv[1]) : 1'000'000};
+    unsigned int maxThreads{ argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : std::max(1u, std::thread::hardware_concurrency())};
+    std::uint64_t seed{ argc > 3 ? std::stoull(argv[3]) : 2021};
+
+    bool ok{ runPolicy("always fight", AlwaysFight{}, lifetimes, maxThreads, seed)};
+    ok = runPolicy("flee below 5 hp", FleeBelowHealth{5}, lifetimes, maxThreads, seed) && ok;
+    ok = runPolicy("flee when outmatched", FleeWhenOutmatched{}, lifetimes, maxThreads, seed) && ok;
+    return ok ? 0 : 1;
+}
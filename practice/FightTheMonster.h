@@ -0,0 +1,114 @@
+#ifndef __FIGHTTHEMONSTER_H
+#define __FIGHTTHEMONSTER_H
+    // Creature/Player/Monster model shared by the interactive game (InheritanceFightTheMonster.cpp)
+    // and the headless simulator (FightSimulator.cpp)
+    #include<string>
+    #include<string_view>
+    #include<array>
+    #include"Random.h" // per-thread generator, replaces rand/srand
+    // Generate a random number between min and max (inclusive) from the calling thread's generator
+    inline int getRandomNumber(int min, int max){
+            return randomInt(min, max);
+    }
+    class Creature{
+    protected:
+        std::string m_name{nullptr};
+        char m_symbol{};
+        int m_health{};
+        int m_damage{};
+        int m_gold{};
+    public:
+        Creature( std::string_view name,  char symbol=' ', int health=0, int damage=0, int gold =0)
+            :m_name(name), m_symbol(symbol), m_health(health), m_damage(damage), m_gold(gold){}
+        Creature(const Creature & src)= default;
+        const std::string& getName()const{ return m_name;}
+        auto getSymbol()const{ return m_symbol;}
+        auto getHealth()const{return m_health;}
+        auto getDamage()const{return m_damage;}
+        auto getGold()const{ return m_gold;}
+
+        void reduceHealth(int amt){ m_health -= amt;}
+        bool isDead()const{ return m_health <= 0;}
+        void addGold(int amt){ m_gold +=amt;}
+    };
+
+    class Player: public Creature{
+        int m_level{1};
+        static constexpr int maxPlayerLevel{20};
+    public:
+        Player(std::string_view name) : Creature{name, '@', 10, 1, 0}, m_level{1}{}
+        // restore a saved player (replay snapshots)
+        Player(std::string_view name, int health, int damage, int gold, int level)
+            : Creature{name, '@', health, damage, gold}, m_level{level}{}
+        int getLevel()const{ return m_level;}
+        void levelUp(){ ++m_level; ++m_damage;}
+        bool hasWon()const{ return m_level >= maxPlayerLevel;}
+    };
+    // Flyweight monster: name, symbol & base stats live once per type in a static archetype table,
+    // a Monster only points at its archetype and owns the state that changes in a fight (health).
+    // Spawning copies three words instead of a whole Creature with its std::string, and allocates nothing.
+    // Same interface as Creature for everything the fight code reads.
+    class Monster{
+    public:
+        enum class Type{ dragon, orc, slime , max_types    };
+        struct Archetype{
+            std::string_view name{};
+            char symbol{};
+            int health{};
+            int damage{};
+            int gold{};
+        };
+        Monster(Type type) : m_archetype{&getArchetype(type)}, m_type{type}, m_health{m_archetype->health}{}
+        // restore a monster part way through a fight (replay snapshots)
+        Monster(Type type, int health) : m_archetype{&getArchetype(type)}, m_type{type}, m_health{health}{}
+        Type getType()const{ return m_type;}
+        std::string_view getName()const{ return m_archetype->name;}
+        char getSymbol()const{ return m_archetype->symbol;}
+        int getHealth()const{ return m_health;}
+        int getDamage()const{ return m_archetype->damage;}
+        int getGold()const{ return m_archetype->gold;}
+
+        void reduceHealth(int amt){ m_health -= amt;}
+        bool isDead()const{ return m_health <= 0;}
+
+        static Monster getRandomMonster(){//return by value, non-const so the result can be moved
+            int idx{ getRandomNumber(0, static_cast<int>(Type::max_types)-1)};
+            return Monster{static_cast<Type>(idx)};
+        }
+        static const Archetype & getArchetype(Type type){
+            static constexpr std::array<Archetype, static_cast<std::size_t>(Type::max_types)> monsterData{
+                {
+                    { "dragon", 'D', 20, 4, 100},
+                    { "orc",    'o', 4, 2 , 25},
+                    { "slime",  's', 1, 1, 10} }   
+            };
+            return monsterData.at(static_cast<std::size_t>(type));
+        }
+    private:
+        const Archetype * m_archetype{};
+        Type m_type{};
+        int m_health{};
+    };
+
+    // what the player answers to "(R)un or (F)ight"
+    enum class Action{ fight, run };
+
+    // Combat rules without any I/O; the interactive game prints around these,
+    // the simulator calls them directly
+    // Player hits the monster; if it dies the player collects its gold & levels up. Returns true on a kill
+    inline bool strikeMonster(Player & player, Monster & monster){
+        monster.reduceHealth(player.getDamage());
+        if(!monster.isDead())
+            return false;
+        player.addGold(monster.getGold());
+        player.levelUp();
+        return true;
+    }
+    inline void strikePlayer(Player & player, const Monster & monster){
+        player.reduceHealth(monster.getDamage());
+    }
+    // 50% chance of fleeing successfully
+    inline bool tryFlee(){
+        return getRandomNumber(0,1);
+    }
+#endif
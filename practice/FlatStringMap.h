@@ -0,0 +1,187 @@
+#ifndef __FLATSTRINGMAP_H
+#define __FLATSTRINGMAP_H
+    /*
+        Read-mostly string -> T map over StringValuePair<T> (Pair.h): one contiguous array sorted by
+        key instead of a linear search over the pairs, or a node per key as in std::map.
+        > bulk load, then freeze: insert() only appends, freeze() sorts once and drops duplicate keys
+          (the last insert of a key wins). Lookups need a frozen map (checked in debug builds);
+          an insert after freeze() unfreezes it
+        > next to the sorted pairs, an array with 8 bytes of every key packed big endian into a
+          std::uint64_t, so comparing two prefixes as integers orders them like the keys. The 8 bytes
+          start after the longest prefix all keys share ("student_" in "student_0001234"), which
+          says nothing about which key it is. find() binary searches that array without branches
+          (a conditional move per step over 8 byte entries, not a string compare on a pair 40+ bytes
+          away) and only reads the keys whose prefix matched; keys sharing those 8 bytes too are told
+          apart by a search over the full keys
+        > the binary search starts from a bucket table (about one bucket per 2 keys, by the high bits
+          of prefix - smallest prefix) that gives the range of the array to search: a few probes in a
+          few cache lines instead of log2(n) probes all over the array
+        > find(std::string_view): no std::string built per lookup
+        > iteration in key order
+    */
+    #include<algorithm>
+    #include<cassert>
+    #include<cstdint>
+    #include<cstring>
+    #include<numeric>
+    #include<string>
+    #include<string_view>
+    #include<utility>
+    #include<vector>
+    #include"Pair.h"
+
+    template<typename T>
+    class FlatStringMap{
+        std::vector<StringValuePair<T>> m_entries{};
+        std::vector<std::uint64_t> m_prefixes{};// same order as m_entries once frozen
+        std::vector<std::uint32_t> m_buckets{};// bucket b is [m_buckets[b], m_buckets[b + 1]) of m_prefixes
+        std::uint64_t m_minPrefix{};
+        unsigned int m_bucketShift{};
+        std::size_t m_skip{};// length of the prefix shared by all keys
+        bool m_frozen{ true};
+
+        static std::string_view keyOf(const StringValuePair<T> & entry){ return entry.first();}
+        // first index in [first, last) whose prefix is >= prefix (last if none); branch free
+        std::size_t lowerBound(std::uint64_t prefix, std::size_t first, std::size_t last) const {
+            const std::uint64_t * base{ m_prefixes.data() + first};
+            std::size_t n{ last - first};
+            if(n == 0)
+                return first;
+            while(n > 1){
+                const std::size_t half{ n / 2};
+                base = base[half] < prefix ? base + half : base;
+                n -= half;
+            }
+            return static_cast<std::size_t>(base - m_prefixes.data()) + (*base < prefix);
+        }
+        void buildBuckets(){
+            m_buckets.clear();
+            if(m_prefixes.empty())
+                return;
+            std::size_t bucketCount{ 2};// so that range >> 63 always fits
+            while(bucketCount < m_prefixes.size() / 2)
+                bucketCount *= 2;
+            m_minPrefix = m_prefixes.front();
+            const std::uint64_t range{ m_prefixes.back() - m_minPrefix};
+            m_bucketShift = 0;
+            while((range >> m_bucketShift) >= bucketCount)
+                ++m_bucketShift;
+            m_buckets.resize(bucketCount + 1);
+            std::size_t i{};
+            for(std::size_t b{}; b <= bucketCount; ++b){
+                while(i < m_prefixes.size() && ((m_prefixes[i] - m_minPrefix) >> m_bucketShift) < b)
+                    ++i;
+                m_buckets[b] = static_cast<std::uint32_t>(i);
+            }
+        }
+    public:
+        using value_type = StringValuePair<T>;
+        using const_iterator = typename std::vector<StringValuePair<T>>::const_iterator;
+
+        // the 8 bytes of key from `skip` on, zero padded
+        static std::uint64_t prefixOf(std::string_view key, std::size_t skip = 0){
+            unsigned char bytes[8]{};
+            if(key.size() > skip)
+                std::memcpy(bytes, key.data() + skip, std::min<std::size_t>(key.size() - skip, 8));
+            std::uint64_t prefix{};
+            for(unsigned char byte : bytes)
+                prefix = (prefix << 8) | byte;
+            return prefix;
+        }
+
+        void reserve(std::size_t n){
+            m_entries.reserve(n);
+            m_prefixes.reserve(n);
+        }
+        template<typename Key, typename... Args>
+        void insert(Key && key, Args &&... args){
+            m_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<Key>(key)),
+                                   std::forward_as_tuple(std::forward<Args>(args)...));
+            m_frozen = false;
+        }
+        // sorts by (prefix, key), a stable order so that the last insert of a key is kept
+        void freeze(){
+            if(m_frozen)
+                return;
+            std::vector<std::uint64_t> prefixes(m_entries.size());
+            for(std::size_t i{}; i < m_entries.size(); ++i)
+                prefixes[i] = prefixOf(keyOf(m_entries[i]));
+            std::vector<std::size_t> order(m_entries.size());
+            std::iota(order.begin(), order.end(), std::size_t{});
+            std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b){
+                if(prefixes[a] != prefixes[b])
+                    return prefixes[a] < prefixes[b];
+                const int byKey{ keyOf(m_entries[a]).compare(keyOf(m_entries[b]))};
+                return byKey != 0 ? byKey < 0 : a < b;
+            });
+            std::vector<StringValuePair<T>> entries{};
+            entries.reserve(m_entries.size());
+            m_prefixes.clear();
+            m_prefixes.reserve(m_entries.size());
+            for(std::size_t i{}; i < order.size(); ++i){
+                const bool replaced{ i + 1 < order.size() && prefixes[order[i]] == prefixes[order[i + 1]]
+                                     && keyOf(m_entries[order[i]]) == keyOf(m_entries[order[i + 1]])};
+                if(replaced)
+                    continue;
+                entries.push_back(std::move(m_entries[order[i]]));
+                m_prefixes.push_back(prefixes[order[i]]);
+            }
+            m_entries = std::move(entries);
+            assert(m_entries.size() <= UINT32_MAX);
+            // all keys share the first m_skip bytes: take the prefixes after them
+            m_skip = 0;
+            if(!m_entries.empty()){
+                const std::string_view low{ keyOf(m_entries.front())};
+                const std::string_view high{ keyOf(m_entries.back())};
+                while(m_skip < low.size() && m_skip < high.size() && low[m_skip] == high[m_skip])
+                    ++m_skip;
+                if(m_skip)
+                    for(std::size_t i{}; i < m_entries.size(); ++i)
+                        m_prefixes[i] = prefixOf(keyOf(m_entries[i]), m_skip);
+            }
+            buildBuckets();
+            m_frozen = true;
+        }
+        bool isFrozen() const { return m_frozen;}
+
+        const T * find(std::string_view key) const {
+            assert(m_frozen && "FlatStringMap: freeze() after inserting");
+            if(m_entries.empty() || key.compare(0, m_skip, keyOf(m_entries.front()), 0, m_skip) != 0)
+                return nullptr;
+            const std::uint64_t prefix{ prefixOf(key, m_skip)};
+            if(prefix < m_minPrefix)
+                return nullptr;
+            const std::uint64_t bucket{ (prefix - m_minPrefix) >> m_bucketShift};
+            if(bucket + 1 >= m_buckets.size())
+                return nullptr;
+            const std::size_t bucketEnd{ m_buckets[bucket + 1]};
+            const std::size_t first{ lowerBound(prefix, m_buckets[bucket], bucketEnd)};
+            if(first == bucketEnd || m_prefixes[first] != prefix)
+                return nullptr;
+            std::size_t last{ first + 1};
+            if(last < bucketEnd && m_prefixes[last] == prefix)// keys sharing these 8 bytes too
+                last = static_cast<std::size_t>(std::upper_bound(m_prefixes.begin() + static_cast<std::ptrdiff_t>(last),
+                                                                 m_prefixes.begin() + static_cast<std::ptrdiff_t>(bucketEnd), prefix) - m_prefixes.begin());
+            auto found{ std::lower_bound(m_entries.begin() + static_cast<std::ptrdiff_t>(first), m_entries.begin() + static_cast<std::ptrdiff_t>(last),
+                                         key, [](const StringValuePair<T> & entry, std::string_view k){ return keyOf(entry) < k;})};
+            if(found == m_entries.begin() + static_cast<std::ptrdiff_t>(last) || keyOf(*found) != key)
+                return nullptr;
+            return &found->second();
+        }
+        bool contains(std::string_view key) const { return find(key) != nullptr;}
+
+        std::size_t size() const { return m_entries.size();}
+        bool empty() const { return m_entries.empty();}
+        const_iterator begin() const { return m_entries.begin();}
+        const_iterator end() const { return m_entries.end();}
+        // arrays plus key characters that live outside the small string buffer
+        std::size_t memoryBytes() const {
+            std::size_t bytes{ m_entries.capacity() * sizeof(StringValuePair<T>) + m_prefixes.capacity() * sizeof(std::uint64_t)
+                               + m_buckets.capacity() * sizeof(std::uint32_t)};
+            for(const auto & entry : m_entries)
+                if(entry.first().capacity() > std::string{}.capacity())
+                    bytes += entry.first().capacity() + 1;
+            return bytes;
+        }
+    };
+#endif
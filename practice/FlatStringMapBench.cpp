@@ -0,0 +1,152 @@
+/*
+    FlatStringMap (FlatStringMap.h) vs std::map<std::string, T, std::less<>> and
+    std::unordered_map<std::string, T> for a lookup heavy workload: build time, ns per lookup (half
+    hits, half misses) and heap bytes, for random keys and for keys sharing a long prefix
+    ("student_0000123"). Every lookup result is checked against std::map.
+    Heap bytes are counted by replacing global operator new/delete.
+
+    build: g++ -std=c++17 -O2 FlatStringMapBench.cpp
+    usage: FlatStringMapBench [keys] [lookups]
+*/
+#include<iostream>
+#include<string>
+#include<vector>
+#include<map>
+#include<unordered_map>
+#include<chrono>
+#include<cstddef>
+#include<cstdio>
+#include<cstdlib>
+#include<new>
+#include"FlatStringMap.h"
+#include"Random.h"
+
+// live heap bytes as requested, from a size header in front of each block (malloc_usable_size is glibc only)
+static std::size_t g_heapBytes{};
+constexpr std::size_t headerBytes{ alignof(std::max_align_t)};
+void * operator new(std::size_t size){
+    if(void * block{ std::malloc(headerBytes + size)}){
+        *static_cast<std::size_t *>(block) = size;
+        g_heapBytes += size;
+        return static_cast<char *>(block) + headerBytes;
+    }
+    throw std::bad_alloc{};
+}
+// not inlined into the library's sized deletes, where GCC would see free() on an operator new pointer
+[[gnu::noinline]] void operator delete(void * p) noexcept {
+    if(!p)
+        return;
+    void * block{ static_cast<char *>(p) - headerBytes};
+    g_heapBytes -= *static_cast<std::size_t *>(block);
+    std::free(block);
+}
+void operator delete(void * p, std::size_t) noexcept { operator delete(p);}
+
+template<typename Func>
+double nsPer(std::size_t count, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(count);
+}
+bool run(const char * name, const std::vector<std::string> & keys, const std::vector<std::string> & queries){
+    std::cout<<name<<": "<<keys.size()<<" keys, "<<queries.size()<<" lookups\n";
+    const std::size_t lookups{ queries.size()};
+    bool ok{ true};
+
+    std::size_t before{ g_heapBytes};
+    FlatStringMap<int> flat{};
+    double flatBuild{ nsPer(keys.size(), [&]{
+        flat.reserve(keys.size());
+        for(std::size_t i{}; i < keys.size(); ++i)
+            flat.insert(keys[i], static_cast<int>(i));
+        flat.freeze();
+    })};
+    std::size_t flatBytes{ g_heapBytes - before};
+
+    before = g_heapBytes;
+    std::map<std::string, int, std::less<>> tree{};
+    double treeBuild{ nsPer(keys.size(), [&]{
+        for(std::size_t i{}; i < keys.size(); ++i)
+            tree[keys[i]] = static_cast<int>(i);
+    })};
+    std::size_t treeBytes{ g_heapBytes - before};
+
+    before = g_heapBytes;
+    std::unordered_map<std::string, int> hash{};
+    double hashBuild{ nsPer(keys.size(), [&]{
+        hash.reserve(keys.size());
+        for(std::size_t i{}; i < keys.size(); ++i)
+            hash[keys[i]] = static_cast<int>(i);
+    })};
+    std::size_t hashBytes{ g_heapBytes - before};
+
+    // correctness: every query, plus iteration order & size
+    ok = ok && flat.size() == tree.size() && std::equal(flat.begin(), flat.end(), tree.begin(), tree.end(),
+        [](const StringValuePair<int> & a, const auto & b){ return a.first() == b.first && a.second() == b.second;});
+    for(const auto & query : queries){
+        auto it{ tree.find(std::string_view{ query})};
+        const int * value{ flat.find(query)};
+        ok = ok && (it == tree.end() ? value == nullptr : value && *value == it->second);
+    }
+
+    long long sink{};
+    double flatFind{ nsPer(lookups, [&]{
+        for(const auto & query : queries)
+            if(const int * value{ flat.find(query)})
+                sink += *value;
+    })};
+    double treeFind{ nsPer(lookups, [&]{
+        for(const auto & query : queries){
+            auto it{ tree.find(std::string_view{ query})};
+            if(it != tree.end())
+                sink += it->second;
+        }
+    })};
+    double hashFind{ nsPer(lookups, [&]{
+        for(const auto & query : queries){
+            auto it{ hash.find(query)};
+            if(it != hash.end())
+                sink += it->second;
+        }
+    })};
+    std::cout<<"                    build ns/key  lookup ns  heap bytes/key\n"
+             <<"  FlatStringMap     "<<flatBuild<<"\t"<<flatFind<<"\t"<<static_cast<double>(flatBytes) / keys.size()<<"\n"
+             <<"  std::map          "<<treeBuild<<"\t"<<treeFind<<"\t"<<static_cast<double>(treeBytes) / keys.size()<<"\n"
+             <<"  std::unordered_map"<<hashBuild<<"\t"<<hashFind<<"\t"<<static_cast<double>(hashBytes) / keys.size()<<"\n";
+    return ok && sink != -1;
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    std::size_t lookups{ argc > 2 ? std::stoul(argv[2]) : 2'000'000};
+    Random rng{ 3};
+
+    auto makeQueries{ [&](const std::vector<std::string> & keys, auto && makeMiss){
+        std::vector<std::string> queries(lookups);
+        for(auto & query : queries)
+            query = rng.getInt(0, 1) ? keys[static_cast<std::size_t>(rng.getInt(0, static_cast<int>(keys.size()) - 1))] : makeMiss();
+        return queries;
+    }};
+    auto randomKey{ [&rng]{
+        std::string key(static_cast<std::size_t>(rng.getInt(4, 24)), ' ');
+        for(auto & c : key)
+            c = static_cast<char>(rng.getInt('a', 'z'));
+        return key;
+    }};
+    std::vector<std::string> keys(count);
+    for(auto & key : keys)
+        key = randomKey();
+    bool ok{ run("random keys, 4-24 chars", keys, makeQueries(keys, randomKey))};
+
+    auto studentKey{ [&rng, count]{
+        char text[32];
+        std::snprintf(text, sizeof(text), "student_%07d", rng.getInt(0, static_cast<int>(count) * 2));
+        return std::string{ text};
+    }};
+    for(auto & key : keys)
+        key = studentKey();
+    ok = run("shared prefix, \"student_0001234\"", keys, makeQueries(keys, studentKey)) && ok;
+
+    std::cout<<(ok ? "lookups match std::map\n" : "MISMATCH\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,42 @@
+#ifndef __FRACTION_H
+#define __FRACTION_H
+    // Fraction from overloadingExamples.cpp; shared with the bulk parser (FractionParser.h)
+    #include<iostream>
+    #include<limits>
+    class Fraction{
+        int m_num{};
+        int m_deno{};
+    public:
+        Fraction(int num =0, int deno =1):m_num{num}, m_deno{deno} {
+        }
+        int getNumerator() const { return m_num;}
+        int getDenominator() const { return m_deno;}
+        void print() const{
+            std::cout<<m_num<<"/"<<m_deno<<"\n";
+        }
+        friend Fraction operator*(const Fraction & f1, const Fraction &f2);
+        friend Fraction operator*(const Fraction & f1, int mul);
+        friend Fraction operator*( int mul,const Fraction & f1);
+        friend std::ostream & operator<<(std::ostream & out , const Fraction  & fr);
+        friend std::istream & operator>>(std::istream & in ,  Fraction  & fr);
+    };
+    inline std::ostream & operator<<(std::ostream & out , const Fraction  & fr){
+        out<<fr.m_num<<"/"<<fr.m_deno;
+        return out;
+    }
+    inline std::istream & operator>>(std::istream & in ,  Fraction  & fr){
+        in>>fr.m_num;
+        in.ignore(std::numeric_limits<std::streamsize>::max(),'/');
+        in>>fr.m_deno;
+        return in;
+    }
+    inline Fraction operator*(const Fraction & f1, const Fraction &f2){
+        return {f1.m_num *f2.m_num, f1.m_deno *f2.m_deno};
+    }
+    inline Fraction operator*(const Fraction & f1, int mul){
+        return {f1.m_num *mul, f1.m_deno};
+    }
+    inline Fraction operator*( int mul,const Fraction & f1){
+        return {f1 * mul};
+    }
+#endif
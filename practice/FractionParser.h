@@ -0,0 +1,103 @@
+#ifndef __FRACTIONPARSER_H
+#define __FRACTIONPARSER_H
+    /*
+        Bulk loader for files of "num/den" records, instead of `in >> fraction` per record
+        (operator>> goes through locale aware iostream formatting plus an ignore(..., '/') per record).
+        > the file is read in large chunks (default 1 MiB) into one buffer; a record cut at the end of a
+          chunk is moved to the front and completed by the next read
+        > numbers are parsed with std::from_chars, no locale, no allocation per record
+        > records are separated by whitespace; a record is `int/int` with a non-zero denominator.
+          Anything else is malformed: its index & byte offset go into the errors list and parsing
+          carries on with the next record
+        > output is one contiguous std::vector<Fraction>
+    */
+    #include<charconv>
+    #include<cstdio>
+    #include<string>
+    #include<vector>
+    #include"Fraction.h"
+
+    struct FractionParseError{
+        std::size_t record{};// 0-based index among all records, good & bad
+        std::size_t offset{};// byte offset of the record in the file
+    };
+    struct FractionParseResult{
+        std::vector<Fraction> fractions{};
+        std::vector<FractionParseError> errors{};
+        std::size_t records{};
+        std::size_t bytes{};
+    };
+
+    class FractionParser{
+        FractionParseResult m_result{};
+
+        static bool isSpace(char c){ return c == ' ' || c == '\n' || c == '\r' || c == '\t';}
+    public:
+        // parses the complete records of [first, last) in one pass: from_chars straight over the buffer,
+        // no separate tokenizing. With `final` false the trailing record may be cut off, so it is left
+        // alone. Returns where the unparsed tail starts. `base` = file offset of first
+        const char * parse(const char * first, const char * last, std::size_t base, bool final){
+            const char * p{ first};
+            auto & fractions{ m_result.fractions};
+            std::size_t records{ m_result.records};
+            while(true){
+                while(p != last && isSpace(*p))
+                    ++p;
+                if(p == last)
+                    break;
+                const char * start{ p};
+                int num{}, den{};
+                auto [slash, numError]{ std::from_chars(p, last, num)};
+                bool ok{ numError == std::errc{} && slash != last && *slash == '/'};
+                if(ok){
+                    auto [end, denError]{ std::from_chars(slash + 1, last, den)};
+                    p = end;
+                    ok = denError == std::errc{} && den != 0 && (end == last || isSpace(*end));
+                }
+                if(!ok){// skip the rest of the bad record
+                    while(p != last && !isSpace(*p))
+                        ++p;
+                }
+                if(p == last && !final){// may continue in the next chunk
+                    p = start;
+                    break;
+                }
+                if(ok)
+                    fractions.emplace_back(num, den);
+                else
+                    m_result.errors.push_back({ records, base + static_cast<std::size_t>(start - first)});
+                ++records;
+            }
+            m_result.records = records;
+            return p;
+        }
+        bool parseFile(const std::string & path, std::size_t chunkSize = std::size_t{1} << 20){
+            std::FILE * file{ std::fopen(path.c_str(), "rb")};
+            if(!file)
+                return false;
+            std::vector<char> buffer(chunkSize);
+            std::size_t kept{};// bytes of an unfinished record carried over from the previous chunk
+            std::size_t base{};// file offset of buffer[0]
+            while(true){
+                if(kept == buffer.size())// one record longer than the buffer
+                    buffer.resize(buffer.size() * 2);
+                const std::size_t got{ std::fread(buffer.data() + kept, 1, buffer.size() - kept, file)};
+                const bool final{ got == 0};
+                const char * end{ buffer.data() + kept + got};
+                const char * tail{ parse(buffer.data(), end, base, final)};
+                m_result.bytes += got;
+                if(final)
+                    break;
+                kept = static_cast<std::size_t>(end - tail);
+                base += static_cast<std::size_t>(tail - buffer.data());
+                std::copy(tail, end, buffer.data());
+            }
+            const bool ok{ !std::ferror(file)};
+            std::fclose(file);
+            return ok;
+        }
+        void reserve(std::size_t records){ m_result.fractions.reserve(records);}
+        const FractionParseResult & getResult() const { return m_result;}
+        FractionParseResult takeResult(){ return std::move(m_result);}
+    };
+#endif
@@ -0,0 +1,62 @@
+/*
+    Loading a file of "num/den" records: `in >> fraction` in a loop vs FractionParser (FractionParser.h)
+
+    build: g++ -std=c++17 -O2 FractionParserBench.cpp
+    usage: FractionParserBench [records] [file]
+*/
+#include<iostream>
+#include<fstream>
+#include<chrono>
+#include<string>
+#include<vector>
+#include<cstdio>
+#include"FractionParser.h"
+#include"Random.h"
+
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 5'000'000};
+    std::string path{ argc > 2 ? argv[2] : "fractions.txt"};
+    {
+        Random rng{ 11};
+        std::ofstream out{ path};
+        for(std::size_t i{}; i < count; ++i)
+            out<<rng.getInt(-1'000'000, 1'000'000)<<"/"<<rng.getInt(1, 1'000'000)<<(i % 8 == 7 ? '\n' : ' ');
+    }
+
+    auto start{ std::chrono::steady_clock::now()};
+    std::vector<Fraction> viaStream{};
+    {
+        std::ifstream in{ path};
+        Fraction f{};
+        while(in >> f)
+            viaStream.push_back(f);
+    }
+    std::chrono::duration<double> streamTime{ std::chrono::steady_clock::now() - start};
+
+    start = std::chrono::steady_clock::now();
+    FractionParser parser{};
+    parser.parseFile(path);
+    std::chrono::duration<double> bulkTime{ std::chrono::steady_clock::now() - start};
+    const FractionParseResult & result{ parser.getResult()};
+
+    bool same{ viaStream.size() == result.fractions.size()};
+    for(std::size_t i{}; same && i < viaStream.size(); ++i)
+        same = viaStream[i].getNumerator() == result.fractions[i].getNumerator()
+            && viaStream[i].getDenominator() == result.fractions[i].getDenominator();
+    const double megabytes{ result.bytes / 1e6};
+    std::cout<<count<<" records, "<<megabytes<<" MB\n"
+             <<"  operator>>     : "<<megabytes / streamTime.count()<<" MB/s\n"
+             <<"  FractionParser : "<<megabytes / bulkTime.count()<<" MB/s ("
+             <<streamTime.count() / bulkTime.count()<<"x)"<<(same ? "" : "  MISMATCH")<<"\n";
+
+    // malformed records are reported by position, the rest still load
+    std::ofstream{ path}<<"1/2 3/x 4/5\n6/0 -7/8 9\n";
+    FractionParser checker{};
+    checker.parseFile(path, 4);// tiny chunks: records get split across reads
+    std::cout<<"  malformed test: "<<checker.getResult().fractions.size()<<" parsed, errors at";
+    for(const auto & error : checker.getResult().errors)
+        std::cout<<" record "<<error.record<<" (byte "<<error.offset<<")";
+    std::cout<<"\n";
+    std::remove(path.c_str());
+    return same && checker.getResult().errors.size() == 3 && checker.getResult().fractions.size() == 3 ? 0 : 1;
+}
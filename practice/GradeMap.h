@@ -0,0 +1,132 @@
+#ifndef __GRADEMAP_H
+#define __GRADEMAP_H
+    /*
+        GradeMap from overloadingExamples.cpp with O(1) lookup, references that stay valid and a compact layout.
+        The original keeps std::vector<StudentGrade> and runs find_if comparing full std::strings,
+        O(n) per lookup, and push_back moves the elements so `char & g{ grades["Joe"] }` dangles
+        after the next new student. A StudentGrade is also a 32 byte std::string (plus a heap block
+        for names over 15 chars) next to a single char.
+        > names are interned in a NameTable (NameTable.h): stored once in a contiguous arena, hashed
+          index, student = 32 bit id
+        > grades are a parallel char array indexed by id. It is a std::deque<char>: push_back never
+          moves existing elements, so references handed out by operator[] stay valid for the life of the map
+        > lookups take std::string_view: a literal or a std::string is looked up without building a
+          temporary std::string
+        > importFile(): bulk load of "name grade" lines, see below
+    */
+    #include<cstdint>
+    #include<cstdio>
+    #include<cstring>
+    #include<deque>
+    #include<string>
+    #include<string_view>
+    #include<vector>
+    #include"Expected.h"
+    #include"NameTable.h"
+
+    // the original record type, kept for code still using it
+    struct StudentGrade {
+        std::string m_name{};
+        char m_grade{}      ;
+    };
+    struct GradeImportError{
+        std::size_t line{};// 1-based; 0 when the file can't be read
+    };
+
+    class GradeMap {
+        NameTable m_names{};
+        std::deque<char> m_grades{};
+    public:
+        void reserve(std::size_t students, std::size_t nameChars = 0){ m_names.reserve(students, nameChars);}
+        std::size_t size() const { return m_grades.size();}
+        void shrinkToFit(){
+            m_names.shrinkToFit();
+            m_grades.shrink_to_fit();
+        }
+
+        char & operator[](std::string_view name){
+            const std::uint32_t id{ m_names.intern(name)};
+            if(id == m_grades.size())
+                m_grades.push_back(char{});
+            return m_grades[id];
+        }
+        // nullptr when the student is unknown; never inserts
+        const char * find(std::string_view name) const {
+            const std::uint32_t id{ m_names.find(name)};
+            return id == NameTable::npos ? nullptr : &m_grades[id];
+        }
+        const NameTable & getNames() const { return m_names;}
+        char getGrade(std::uint32_t id) const { return m_grades[id];}
+        std::size_t memoryBytes() const {
+            // a deque<char> stores 512 byte blocks plus a map of block pointers
+            return m_names.memoryBytes() + (m_grades.size() / 512 + 1) * (512 + sizeof(char *));
+        }
+
+        // One record per line: the name, whitespace, then a one character grade ("Joe Smith A").
+        // The name may contain spaces, blanks around it are dropped; blank lines are skipped, a later line for the same name
+        // overwrites the grade. [first, last) must hold complete lines
+        Expected<std::size_t, GradeImportError> import(const char * first, const char * last){
+            std::size_t line{ 1};
+            return importLines(first, last, line);
+        }
+        // reads the file in 1 MiB chunks; a line cut at the end of a chunk is carried over to the next one
+        Expected<std::size_t, GradeImportError> importFile(const std::string & path, std::size_t chunkSize = std::size_t{1} << 20){
+            std::FILE * file{ std::fopen(path.c_str(), "rb")};
+            if(!file)
+                return unexpected(GradeImportError{ 0});
+            std::vector<char> buffer(chunkSize);
+            std::size_t carried{}, line{ 1}, records{};
+            while(true){
+                if(carried == buffer.size())// a line longer than the buffer
+                    buffer.resize(buffer.size() * 2);
+                const std::size_t got{ std::fread(buffer.data() + carried, 1, buffer.size() - carried, file)};
+                const std::size_t filled{ carried + got};
+                const bool final{ got == 0};
+                const char * first{ buffer.data()};
+                const char * last{ first + filled};
+                if(!final){// stop after the last complete line
+                    while(last != first && last[-1] != '\n')
+                        --last;
+                }
+                auto result{ importLines(first, last, line)};
+                if(!result){
+                    std::fclose(file);
+                    return result;
+                }
+                records += *result;
+                carried = static_cast<std::size_t>(buffer.data() + filled - last);
+                std::memmove(buffer.data(), last, carried);
+                if(final)
+                    break;
+            }
+            std::fclose(file);
+            return records;
+        }
+    private:
+        static bool isSpace(char c){ return c == ' ' || c == '\t' || c == '\r';}
+        Expected<std::size_t, GradeImportError> importLines(const char * first, const char * last, std::size_t & line){
+            std::size_t records{};
+            for(const char * p{ first}; p != last; ++line){
+                const char * end{ static_cast<const char *>(std::memchr(p, '\n', static_cast<std::size_t>(last - p)))};
+                if(!end)
+                    end = last;
+                while(p != end && isSpace(*p))
+                    ++p;
+                const char * back{ end};
+                while(back != p && isSpace(back[-1]))
+                    --back;
+                if(back != p){
+                    const char * nameEnd{ back - 1};
+                    while(nameEnd != p && isSpace(nameEnd[-1]))
+                        --nameEnd;
+                    if(nameEnd == p || nameEnd == back - 1)// no name, or no space before the grade
+                        return unexpected(GradeImportError{ line});
+                    (*this)[std::string_view{ p, static_cast<std::size_t>(nameEnd - p)}] = back[-1];
+                    ++records;
+                }
+                p = end == last ? last : end + 1;
+            }
+            return records;
+        }
+    };
+#endif
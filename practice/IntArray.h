@@ -0,0 +1,82 @@
+#ifndef __INTARRAY_H
+#define __INTARRAY_H
+    /*
+        IntArray from overloadingExamples.cpp (e.g 5) with move support and allocation reuse.
+        > move constructor & move assignment: steal the buffer, the source is left empty (size 0, no buffer)
+        > copy assignment reuses the existing buffer when it is big enough (m_capacity), so assigning
+          arrays of the same or a smaller size never allocates; otherwise the new buffer is allocated
+          before the old one is freed, a failing new leaves the target untouched
+        > elements are copied with one std::memcpy (int is trivially copyable)
+        > the copy constructor initializes its own members instead of running deepcopy() on a fresh object
+    */
+    #include<cassert>
+    #include<cstring>
+    #include<iostream>
+    #include<utility>
+
+    class IntArray{
+        int m_size{0};
+        int m_capacity{0};
+        int *m_arr{nullptr};
+
+        void deepcopy(const IntArray & src){
+            if(src.m_size > m_capacity){
+                int * fresh{ new int[src.m_size]};
+                delete[] m_arr;
+                m_arr = fresh;
+                m_capacity = src.m_size;
+            }
+            m_size = src.m_size;
+            if(m_size > 0)
+                std::memcpy(m_arr, src.m_arr, sizeof(int) * static_cast<std::size_t>(m_size));
+        }
+    public:
+        IntArray() = delete;
+        IntArray(int size):m_size{size}, m_capacity{size}{
+            assert(size>0);
+            m_arr= new int[size]{};
+        };
+        IntArray(const IntArray &src)
+            :m_size{src.m_size}, m_capacity{src.m_size}, m_arr{ src.m_size > 0 ? new int[src.m_size] : nullptr}{
+            if(m_size > 0)
+                std::memcpy(m_arr, src.m_arr, sizeof(int) * static_cast<std::size_t>(m_size));
+        }
+        IntArray(IntArray &&src) noexcept
+            :m_size{ std::exchange(src.m_size, 0)}, m_capacity{ std::exchange(src.m_capacity, 0)},
+             m_arr{ std::exchange(src.m_arr, nullptr)}{}
+        IntArray & operator=(const IntArray &src){
+            if(this == &src)
+                return *this;
+            deepcopy(src);
+            return *this;
+        }
+        IntArray & operator=(IntArray &&src) noexcept {
+            if(this == &src)
+                return *this;
+            delete[] m_arr;
+            m_size = std::exchange(src.m_size, 0);
+            m_capacity = std::exchange(src.m_capacity, 0);
+            m_arr = std::exchange(src.m_arr, nullptr);
+            return *this;
+        }
+        int& operator[](int index){
+            assert((index >= 0 )&& (index< m_size));
+            return m_arr[index];
+        }
+        int operator[](int index) const {
+            assert((index >= 0 )&& (index< m_size));
+            return m_arr[index];
+        }
+        int getSize() const { return m_size;}
+        int getCapacity() const { return m_capacity;}
+        friend std::ostream & operator <<(std::ostream &out, const IntArray & arr){
+            for(int i =0; i < arr.m_size; i++)
+                out<<arr.m_arr[i]<<" ";
+            out<<"\n";
+            return out;
+        }
+        ~IntArray(){
+            delete[] m_arr;
+        }
+    };
+#endif
@@ -0,0 +1,131 @@
+/*
+    IntArray (IntArray.h) vs the original from overloadingExamples.cpp: heap allocations and time
+    for the fillArray()/assignment workflow of its main(), repeated.
+    Counts allocations by replacing global operator new[]; fails if the new IntArray allocates
+    where it shouldn't.
+
+    build: g++ -std=c++17 -O2 IntArrayBench.cpp
+    usage: IntArrayBench [iterations] [elements]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<cstdlib>
+#include<new>
+#include"IntArray.h"
+
+static std::size_t g_allocations{};
+void * operator new[](std::size_t size){
+    ++g_allocations;
+    if(void * p{ std::malloc(size ? size : 1)})
+        return p;
+    throw std::bad_alloc{};
+}
+void operator delete[](void * p) noexcept { std::free(p);}
+void operator delete[](void * p, std::size_t) noexcept { std::free(p);}
+
+// the original: no move, assignment always frees & reallocates, element by element copy
+class LegacyIntArray{
+    int m_size{0};
+    int *m_arr{nullptr};
+public:
+    LegacyIntArray(int size):m_size{size}{
+        m_arr= new int[size]{};
+    };
+    void deepcopy(const LegacyIntArray & src) {
+        if(m_arr!= nullptr){
+            delete[] m_arr;
+            m_arr = nullptr;
+        }
+        m_size = src.m_size;
+        if(src.m_arr){
+            m_arr = new int[src.m_size]{};
+            for(int i =0; i <src.m_size; i++){
+                m_arr[i]= src.m_arr[i];
+            }
+        }
+    }
+    LegacyIntArray(const LegacyIntArray &src){
+        deepcopy(src);
+    }
+    LegacyIntArray & operator=(const LegacyIntArray &src){
+        if(this == &src)
+            return *this;
+        deepcopy(src);
+        return *this;
+    }
+    int& operator[](int index){ return m_arr[index];}
+    ~LegacyIntArray(){
+        delete[] m_arr;
+    }
+};
+
+template<typename Array>
+Array fillArray(int elements){
+    Array a(elements);
+    for(int i{}; i < elements; ++i)
+        a[i] = i * 3 + 1;
+    return a;
+}
+struct Result{
+    double allocationsPerIteration{};
+    double nsPerIteration{};
+    long long checksum{};
+};
+// main() of e.g 5, plus the two things it leaves out: refilling an existing array from
+// fillArray() and keeping arrays in a growing vector
+template<typename Array>
+Result workflow(std::size_t iterations, int elements){
+    long long checksum{};
+    std::size_t before{ g_allocations};
+    auto start{ std::chrono::steady_clock::now()};
+    Array b(1);
+    for(std::size_t i{}; i < iterations; ++i){
+        Array a{ fillArray<Array>(elements)};
+        auto &ref{ a };
+        a = ref;
+        b = a;
+        a = fillArray<Array>(elements);
+        checksum += a[elements - 1] + b[0];
+    }
+    std::vector<Array> kept{};
+    for(std::size_t i{}; i < iterations / 16; ++i)
+        kept.push_back(fillArray<Array>(elements));
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return { static_cast<double>(g_allocations - before) / iterations, elapsed.count() / iterations, checksum};
+}
+int main(int argc, char * argv[]){
+    std::size_t iterations{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int elements{ argc > 2 ? std::stoi(argv[2]) : 64};
+
+    Result legacy{ workflow<LegacyIntArray>(iterations, elements)};
+    Result current{ workflow<IntArray>(iterations, elements)};
+    std::cout<<iterations<<" iterations, "<<elements<<" ints\n"
+             <<"  original  : "<<legacy.allocationsPerIteration<<" allocations, "<<legacy.nsPerIteration<<" ns per iteration\n"
+             <<"  IntArray.h: "<<current.allocationsPerIteration<<" allocations, "<<current.nsPerIteration<<" ns per iteration\n";
+
+    // exact counts for the pieces of main()
+    bool ok{ legacy.checksum == current.checksum};
+    auto expect{ [&ok](const char * what, std::size_t allocations, std::size_t expected){
+        std::cout<<"  "<<what<<": "<<allocations<<" allocation(s)\n";
+        ok = ok && allocations == expected;
+    }};
+    std::size_t before{ g_allocations};
+    IntArray a{ fillArray<IntArray>(elements)};
+    expect("IntArray a{ fillArray() }", g_allocations - before, 1);
+    before = g_allocations;
+    auto &ref{ a };
+    a = ref;
+    expect("a = ref (self)           ", g_allocations - before, 0);
+    IntArray b(elements * 2);
+    before = g_allocations;
+    b = a;
+    expect("b = a, b big enough      ", g_allocations - before, 0);
+    before = g_allocations;
+    a = fillArray<IntArray>(elements);
+    expect("a = fillArray()          ", g_allocations - before, 1);
+    IntArray moved{ std::move(a)};
+    ok = ok && a.getSize() == 0 && moved.getSize() == elements && b.getSize() == elements && b[elements - 1] == moved[elements - 1];
+    std::cout<<(ok ? "allocation counts as expected\n" : "FAILED\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,256 @@
+#ifndef __LOCALSHAREDPTR_H
+#define __LOCALSHAREDPTR_H
+    /*
+        LocalSharedPtr / LocalWeakPtr: SharedPointer / WeakPointer (SharedPointer.h) for objects that never
+        leave the thread that made them, e.g. the Person partner graphs of the shared_ptr notes.
+        > counts are plain longs: a copy is an increment, not a lock-prefixed atomic add
+        > thread confinement: debug builds (no NDEBUG) remember the creating thread in the block and
+          assert on every count change made from another thread. Release builds don't check and don't
+          store the thread id
+        > makeLocalShared<T>(args...): block & object in one allocation, as makeShared
+        > LocalWeakPtr::lock() / expired(), aliasing constructor, conversions to a base pointer: as in
+          SharedPointer.h
+        > toShared(): hands the object over to a SharedPointer, for code that has to share it with
+          other threads. Only possible while *this is the one and only reference (no other
+          LocalSharedPtr, no LocalWeakPtr), since those would keep touching the plain counts; otherwise
+          it returns an empty SharedPointer and *this keeps the object. The object is not moved or
+          copied: the SharedPointer's deleter releases the local block, from whatever thread
+    */
+    #include<cassert>
+    #include<cstddef>
+    #include<memory>
+    #include<new>
+    #include<thread>
+    #include<type_traits>
+    #include<utility>
+    #include"SharedPointer.h"
+
+    class LocalControlBlock{
+        long m_strong{ 1};
+        long m_weak{ 1};// LocalWeakPtrs + 1 while m_strong > 0
+    #ifndef NDEBUG
+        std::thread::id m_owner{ std::this_thread::get_id()};// id{} once handed to a SharedPointer
+    #endif
+        virtual void destroyObject() noexcept = 0;
+        virtual void destroyBlock() noexcept = 0;
+    protected:
+        LocalControlBlock() = default;
+        virtual ~LocalControlBlock() = default;
+    public:
+        LocalControlBlock(const LocalControlBlock &) = delete;
+        LocalControlBlock & operator=(const LocalControlBlock &) = delete;
+
+        void checkThread() const noexcept {
+    #ifndef NDEBUG
+            assert((m_owner == std::thread::id{} || m_owner == std::this_thread::get_id())
+                   && "LocalSharedPtr used from a thread other than the one that created it");
+    #endif
+        }
+        void addStrong() noexcept { checkThread(); ++m_strong;}
+        void addWeak() noexcept { checkThread(); ++m_weak;}
+        void releaseStrong() noexcept {
+            checkThread();
+            if(--m_strong == 0){
+                destroyObject();
+                releaseWeak();
+            }
+        }
+        void releaseWeak() noexcept {
+            checkThread();
+            if(--m_weak == 0)
+                destroyBlock();
+        }
+        bool tryAddStrong() noexcept {
+            checkThread();
+            if(m_strong == 0)
+                return false;
+            ++m_strong;
+            return true;
+        }
+        long useCount() const noexcept { return m_strong;}
+        bool unique() const noexcept { return m_strong == 1 && m_weak == 1;}
+        // no longer tied to a thread: only a SharedPointer's deleter refers to it now
+        void disown() noexcept {
+    #ifndef NDEBUG
+            m_owner = std::thread::id{};
+    #endif
+        }
+    };
+
+    template<typename T>
+    class LocalInplaceBlock final : public LocalControlBlock{
+        alignas(T) unsigned char m_storage[sizeof(T)];
+
+        void destroyObject() noexcept override { get()->~T();}
+        void destroyBlock() noexcept override { delete this;}
+    public:
+        template<typename... Args>
+        explicit LocalInplaceBlock(Args &&... args){ ::new(static_cast<void *>(m_storage)) T(std::forward<Args>(args)...);}
+        T * get() noexcept { return std::launder(reinterpret_cast<T *>(m_storage));}
+    };
+    template<typename T, typename Deleter>
+    class LocalPointerBlock final : public LocalControlBlock{
+        T * m_owned{};
+        Deleter m_deleter;
+
+        void destroyObject() noexcept override { m_deleter(m_owned);}
+        void destroyBlock() noexcept override { delete this;}
+    public:
+        LocalPointerBlock(T * owned, Deleter deleter) : m_owned{owned}, m_deleter{ std::move(deleter)}{}
+    };
+
+    template<typename T>
+    class LocalWeakPtr;
+
+    template<typename T>
+    class LocalSharedPtr{
+        T * m_ptr{ nullptr};
+        LocalControlBlock * m_control{ nullptr};
+
+        template<typename Y> friend class LocalSharedPtr;
+        template<typename Y> friend class LocalWeakPtr;
+        template<typename Y, typename... Args> friend LocalSharedPtr<Y> makeLocalShared(Args &&... args);
+
+        // takes over a strong reference the caller already holds
+        struct Adopt{};
+        LocalSharedPtr(Adopt, T * ptr, LocalControlBlock * control) noexcept : m_ptr{ptr}, m_control{control}{}
+        template<typename Y>
+        using Compatible = std::enable_if_t<std::is_convertible_v<Y *, T *>>;
+    public:
+        using element_type = T;
+
+        LocalSharedPtr() noexcept = default;
+        LocalSharedPtr(std::nullptr_t) noexcept {}
+        template<typename Y, typename = Compatible<Y>>
+        explicit LocalSharedPtr(Y * ptr) : LocalSharedPtr{ ptr, std::default_delete<Y>{}}{}
+        template<typename Y, typename Deleter, typename = Compatible<Y>>
+        LocalSharedPtr(Y * ptr, Deleter deleter) : m_ptr{ptr}{
+            try{
+                m_control = new LocalPointerBlock<Y, Deleter>{ ptr, deleter};
+            }catch(...){
+                deleter(ptr);
+                throw;
+            }
+        }
+        // aliasing: shares ownership with r, points at ptr
+        template<typename Y>
+        LocalSharedPtr(const LocalSharedPtr<Y> & r, T * ptr) noexcept : m_ptr{ptr}, m_control{r.m_control}{
+            if(m_control)
+                m_control->addStrong();
+        }
+        template<typename Y>
+        LocalSharedPtr(LocalSharedPtr<Y> && r, T * ptr) noexcept : m_ptr{ptr}, m_control{r.m_control}{
+            r.m_ptr = nullptr;
+            r.m_control = nullptr;
+        }
+        LocalSharedPtr(const LocalSharedPtr & src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            if(m_control)
+                m_control->addStrong();
+        }
+        LocalSharedPtr(LocalSharedPtr && src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            src.m_ptr = nullptr;
+            src.m_control = nullptr;
+        }
+        template<typename Y, typename = Compatible<Y>>
+        LocalSharedPtr(const LocalSharedPtr<Y> & src) noexcept : LocalSharedPtr{ src, static_cast<T *>(src.m_ptr)}{}
+        template<typename Y, typename = Compatible<Y>>
+        LocalSharedPtr(LocalSharedPtr<Y> && src) noexcept : LocalSharedPtr{ std::move(src), static_cast<T *>(src.m_ptr)}{}
+        ~LocalSharedPtr(){
+            if(m_control)
+                m_control->releaseStrong();
+        }
+        LocalSharedPtr & operator=(const LocalSharedPtr & src) noexcept {
+            LocalSharedPtr{ src}.swap(*this);
+            return *this;
+        }
+        LocalSharedPtr & operator=(LocalSharedPtr && src) noexcept {
+            LocalSharedPtr{ std::move(src)}.swap(*this);
+            return *this;
+        }
+        void swap(LocalSharedPtr & other) noexcept {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_control, other.m_control);
+        }
+        void reset() noexcept { LocalSharedPtr{}.swap(*this);}
+
+        // the object moves to a SharedPointer if *this is its only reference, see above
+        SharedPointer<T> toShared(){
+            if(!m_control || !m_control->unique())
+                return {};
+            m_control->checkThread();
+            LocalControlBlock * control{ std::exchange(m_control, nullptr)};
+            T * ptr{ std::exchange(m_ptr, nullptr)};
+            control->disown();
+            // if the SharedPointer's block can't be allocated, the object is released & bad_alloc thrown
+            return { ptr, [control](T *){ control->releaseStrong();}};
+        }
+
+        T * get() const noexcept { return m_ptr;}
+        T & operator*() const noexcept { return *m_ptr;}
+        T * operator->() const noexcept { return m_ptr;}
+        explicit operator bool() const noexcept { return m_ptr != nullptr;}
+        long useCount() const noexcept { return m_control ? m_control->useCount() : 0;}
+
+        friend bool operator==(const LocalSharedPtr & a, const LocalSharedPtr & b) noexcept { return a.m_ptr == b.m_ptr;}
+        friend bool operator!=(const LocalSharedPtr & a, const LocalSharedPtr & b) noexcept { return a.m_ptr != b.m_ptr;}
+        friend bool operator==(const LocalSharedPtr & a, std::nullptr_t) noexcept { return !a;}
+        friend bool operator!=(const LocalSharedPtr & a, std::nullptr_t) noexcept { return static_cast<bool>(a);}
+    };
+
+    template<typename T, typename... Args>
+    LocalSharedPtr<T> makeLocalShared(Args &&... args){
+        auto * control{ new LocalInplaceBlock<T>{ std::forward<Args>(args)...}};
+        return { typename LocalSharedPtr<T>::Adopt{}, control->get(), control};
+    }
+
+    template<typename T>
+    class LocalWeakPtr{
+        T * m_ptr{ nullptr};
+        LocalControlBlock * m_control{ nullptr};
+    public:
+        LocalWeakPtr() noexcept = default;
+        template<typename Y, typename = std::enable_if_t<std::is_convertible_v<Y *, T *>>>
+        LocalWeakPtr(const LocalSharedPtr<Y> & owner) noexcept : m_ptr{ owner.m_ptr}, m_control{ owner.m_control}{
+            if(m_control)
+                m_control->addWeak();
+        }
+        LocalWeakPtr(const LocalWeakPtr & src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            if(m_control)
+                m_control->addWeak();
+        }
+        LocalWeakPtr(LocalWeakPtr && src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            src.m_ptr = nullptr;
+            src.m_control = nullptr;
+        }
+        ~LocalWeakPtr(){
+            if(m_control)
+                m_control->releaseWeak();
+        }
+        LocalWeakPtr & operator=(const LocalWeakPtr & src) noexcept {
+            LocalWeakPtr{ src}.swap(*this);
+            return *this;
+        }
+        LocalWeakPtr & operator=(LocalWeakPtr && src) noexcept {
+            LocalWeakPtr{ std::move(src)}.swap(*this);
+            return *this;
+        }
+        template<typename Y, typename = std::enable_if_t<std::is_convertible_v<Y *, T *>>>
+        LocalWeakPtr & operator=(const LocalSharedPtr<Y> & owner) noexcept {
+            LocalWeakPtr{ owner}.swap(*this);
+            return *this;
+        }
+        void swap(LocalWeakPtr & other) noexcept {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_control, other.m_control);
+        }
+        void reset() noexcept { LocalWeakPtr{}.swap(*this);}
+
+        LocalSharedPtr<T> lock() const noexcept {
+            if(m_control && m_control->tryAddStrong())
+                return { typename LocalSharedPtr<T>::Adopt{}, m_ptr, m_control};
+            return {};
+        }
+        bool expired() const noexcept { return useCount() == 0;}
+        long useCount() const noexcept { return m_control ? m_control->useCount() : 0;}
+    };
+#endif
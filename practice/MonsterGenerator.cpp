@@ -3,7 +3,13 @@
 #include<string_view>
 #include<ctime>
 #include<array>
-#include<cstdlib>
+#include<cstdint>
+#include<vector>
+#include<algorithm>
+#include<functional>
+#include"Random.h"
+#include<thread>
+#include<chrono>
 using std::cout;
 using std::cin;
 
@@ -36,6 +42,7 @@ public:
             return "?????";
         }
     }
+    int getHitPoints()const { return m_hitPoints;}
     void print()const {
         cout<<m_name<<" the "<<getTypeString(m_type)<<" has "<<m_hitPoints<<" hit points and says *"<<m_roar<<"*\n";
     }
@@ -45,37 +52,132 @@ private:
      std::string m_roar{};
      int m_hitPoints{};
  };
+ // Structure-of-arrays batch: one array per field, so a spawn pass writes
+ // four dense streams instead of constructing a Monster (and two strings) per entity
+ struct MonsterBatch{
+    std::vector<Monster::Type> type{};
+    std::vector<int> hitPoints{};
+    std::vector<std::uint8_t> nameIdx{};
+    std::vector<std::uint8_t> roarIdx{};
+
+    std::size_t size()const { return type.size();}
+    void resize(std::size_t count){
+        type.resize(count);
+        hitPoints.resize(count);
+        nameIdx.resize(count);
+        roarIdx.resize(count);
+    }
+ };
  class MonsterGenerator{
      
 	// Generate a random number between min and max (inclusive)
-	// Assumes std::srand() has already been called
-	// Assumes max - min <= RAND_MAX
+	// draws from the calling thread's generator (see Random.h), safe to call from any thread
      static int getRandomNumber(int min, int max){
-        static constexpr double fraction{1.0/(static_cast<double>(RAND_MAX) + 1.0)};
-        return static_cast<double>(std::rand() * fraction *(max - min +1) +min);
+        return randomInt(min, max);
+     }
+    // Counter based random number: a pure function of (seed, counter), so entity i
+    // always gets the same values no matter which thread (or how many) generates it
+     static int getRandomNumber(std::uint64_t seed, std::uint64_t counter, int min, int max){
+        return Random::counterInt(seed, counter, min, max);
+     }
+    // fill entities [first, last) of the batch; every field draws from its own counter
+     static void fillRange(MonsterBatch & batch, std::size_t first, std::size_t last, std::uint64_t seed){
+        constexpr int maxType{ static_cast<int>(Monster::Type::max_monster_types) - 1};
+        constexpr int maxName{ static_cast<int>(s_names.size()) - 1};
+        constexpr int maxRoar{ static_cast<int>(s_roars.size()) - 1};
+        for(std::size_t i{first}; i < last; ++i){
+            const std::uint64_t counter{ i * 4};
+            batch.type[i]      = static_cast<Monster::Type>(getRandomNumber(seed, counter, 0, maxType));
+            batch.hitPoints[i] = getRandomNumber(seed, counter + 1, 1, 100);
+            batch.nameIdx[i]   = static_cast<std::uint8_t>(getRandomNumber(seed, counter + 2, 0, maxName));
+            batch.roarIdx[i]   = static_cast<std::uint8_t>(getRandomNumber(seed, counter + 3, 0, maxRoar));
+        }
      }
 public: 
+    static constexpr std::array s_names{"Blarg", "Moog", "Pksh", "Tyrn", "Mort", "Hans"};
+    static constexpr std::array s_roars{"*ROAR*", "*peep*", "*squeal*", "*whine*", "*hum*", "*burp*"};
+
+    // reproducible runs: same seed, same sequence of generateMonster() on this thread
+    static void seed(std::uint64_t seed){
+        seedRandom(seed);
+    }
     static Monster generateMonster(){
         //return {Monster::Type::skeleton, "Bones", "*rattle*", 4};
         auto type {static_cast<Monster::Type>(getRandomNumber(0,static_cast<int>( Monster::Type::max_monster_types)-1))};
         auto hits { getRandomNumber(1,100)};
 
-        static constexpr std::array s_names{"Blarg", "Moog", "Pksh", "Tyrn", "Mort", "Hans"};
         auto name {s_names[static_cast<unsigned int>(getRandomNumber(0, 5))]};
         
-        static constexpr std::array s_roars{"*ROAR*", "*peep*", "*squeal*", "*whine*", "*hum*", "*burp*"};
         auto roar {s_roars[static_cast<unsigned int>(getRandomNumber(0, 5))]};
         
         return {type, name, roar, hits};
     }
+    // Bulk spawn: fills count entities into batch, split in contiguous chunks over threads.
+    // Output depends only on (count, seed), never on threadCount (0 = hardware concurrency)
+    static void generateMonsters(MonsterBatch & batch, std::size_t count, std::uint64_t seed, unsigned int threadCount = 0){
+        batch.resize(count);
+        if(threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t chunk{ (count + threadCount - 1) / threadCount};
+        std::vector<std::thread> workers{};
+        for(unsigned int t{1}; t < threadCount && t * chunk < count; ++t){
+            workers.emplace_back(fillRange, std::ref(batch), t * chunk, std::min(count, (t + 1) * chunk), seed);
+        }
+        fillRange(batch, 0, std::min(count, chunk), seed);// calling thread takes the first chunk
+        for(auto & worker : workers)
+            worker.join();
+    }
+    // materialize a single batch entry as a Monster (e.g. to print it)
+    static Monster toMonster(const MonsterBatch & batch, std::size_t idx){
+        return {batch.type[idx], s_names[batch.nameIdx[idx]], s_roars[batch.roarIdx[idx]], batch.hitPoints[idx]};
+    }
  };
-int main(){
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));//// set initial seed value to system clock
-    std::rand(); //discard first random value
+ // usage: MonsterGenerator bench [count] [threads]
+ // build with optimization & threads: g++ -std=c++17 -O2 -pthread MonsterGenerator.cpp
+int benchGenerateMonsters(std::size_t count, unsigned int maxThreads){
+    constexpr std::uint64_t seed{ 42};
+    MonsterBatch reference{};
+    MonsterGenerator::generateMonsters(reference, count, seed, 1);
+    // doubling, then maxThreads itself when it isn't a power of two
+    for(unsigned int threads{1}; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads * 2){
+        MonsterBatch batch{};
+        auto start{ std::chrono::steady_clock::now()};
+        MonsterGenerator::generateMonsters(batch, count, seed, threads);
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+        bool same{ batch.type == reference.type && batch.hitPoints == reference.hitPoints
+                && batch.nameIdx == reference.nameIdx && batch.roarIdx == reference.roarIdx};
+        cout<<threads<<" thread(s): "<<count / elapsed.count() / 1e6<<" M entities/sec"
+            <<(same ? "" : "  (MISMATCH with 1 thread!)")<<"\n";
+        if(!same)
+            return 1;
+    }
+    // scalar baseline: one Monster object per generateMonster() call
+    auto start{ std::chrono::steady_clock::now()};
+    std::size_t totalHits{};
+    for(std::size_t i{}; i < count; ++i){
+        Monster m{ MonsterGenerator::generateMonster()};
+        totalHits += static_cast<std::size_t>(m.getHitPoints());
+    }
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+    cout<<"generateMonster() loop: "<<count / elapsed.count() / 1e6<<" M entities/sec (checksum "<<totalHits<<")\n";
+    return 0;
+}
+int main(int argc, char * argv[]){
+    if(argc > 1 && std::string_view{argv[1]} == "bench"){
+        std::size_t count{ argc > 2 ? std::stoul(argv[2]) : 10'000'000};
+        unsigned int threads{ argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : std::max(1u, std::thread::hardware_concurrency())};
+        return benchGenerateMonsters(count, threads);
+    }
+    MonsterGenerator::seed(static_cast<std::uint64_t>(std::time(nullptr)));//// set initial seed value to system clock
    	Monster skeleton{ Monster::Type::skeleton, "Bones", "*rattle*", 4 };
 	skeleton.print();
 
     Monster m{ MonsterGenerator::generateMonster() };
 	m.print();
+
+    MonsterBatch batch{};
+    MonsterGenerator::generateMonsters(batch, 3, static_cast<std::uint64_t>(std::time(nullptr)));
+    for(std::size_t i{}; i < batch.size(); ++i)
+        MonsterGenerator::toMonster(batch, i).print();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+/*
+    Monster spawning: flyweight Monster (FightTheMonster.h) vs the old path that copy-constructed
+    a whole Creature from the static monster table on every spawn.
+    Counts heap allocations by replacing global operator new; fails if the flyweight path allocates.
+
+    build: g++ -std=c++17 -O2 MonsterSpawnBench.cpp
+    usage: MonsterSpawnBench [spawns]
+*/
+#include<iostream>
+#include<string>
+#include<array>
+#include<chrono>
+#include<cstdlib>
+#include<new>
+#include"FightTheMonster.h"
+
+static std::size_t g_allocations{};
+void * operator new(std::size_t size){
+    ++g_allocations;
+    if(void * p{ std::malloc(size ? size : 1)})
+        return p;
+    throw std::bad_alloc{};
+}
+void operator delete(void * p) noexcept { std::free(p);}
+void operator delete(void * p, std::size_t) noexcept { std::free(p);}
+
+// the previous Monster: a Creature copied out of a static table per spawn
+class LegacyMonster: public Creature{
+public:
+    LegacyMonster(Monster::Type type) : Creature{getDefaultCreature(type)}{}
+    static const LegacyMonster getRandomMonster(){
+        int idx{ getRandomNumber(0, static_cast<int>(Monster::Type::max_types)-1)};
+        return LegacyMonster{static_cast<Monster::Type>(idx)};
+    }
+private:
+    static const Creature & getDefaultCreature(Monster::Type type){
+        static const std::array<Creature, static_cast<std::size_t>(Monster::Type::max_types)> monsterData{
+            {
+                { "dragon", 'D', 20, 4, 100},
+                { "orc",    'o', 4, 2 , 25},
+                { "slime",  's', 1, 1, 10} }
+        };
+        return monsterData.at(static_cast<std::size_t>(type));
+    }
+};
+
+template<typename MonsterT>
+void spawn(std::string_view label, std::size_t count){
+    MonsterT::getRandomMonster();// first call builds the static table, keep it out of the count
+    seedRandom(1);
+    long long checksum{};
+    std::size_t allocationsBefore{ g_allocations};
+    auto start{ std::chrono::steady_clock::now()};
+    for(std::size_t i{}; i < count; ++i){
+        MonsterT m{ MonsterT::getRandomMonster()};
+        checksum += m.getHealth() + m.getName().size();
+    }
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    std::size_t allocations{ g_allocations - allocationsBefore};
+    std::cout<<label<<": "<<sizeof(MonsterT)<<" bytes, "<<elapsed.count() / count<<" ns/spawn, "
+             <<allocations<<" allocations (checksum "<<checksum<<")\n";
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 10'000'000};
+    spawn<LegacyMonster>("Creature copy", count);
+    spawn<Monster>("flyweight    ", count);
+
+    // allocation check for the flyweight path, including copies and moves
+    std::size_t allocationsBefore{ g_allocations};
+    Monster m{ Monster::getRandomMonster()};
+    Monster copy{ m};
+    Monster moved{ std::move(copy)};
+    moved.reduceHealth(1);
+    if(g_allocations != allocationsBefore || m.getHealth() == moved.getHealth()){
+        std::cout<<"FAILED: flyweight spawn allocated or shares mutable state\n";
+        return 1;
+    }
+    std::cout<<"flyweight spawn/copy/move: 0 allocations, health is per instance\n";
+    return 0;
+}
@@ -0,0 +1,109 @@
+#ifndef __NAMETABLE_H
+#define __NAMETABLE_H
+    /*
+        String interning arena: every distinct name is stored once and from then on referred to by a
+        32 bit id (0, 1, 2, ... in order of first appearance).
+        > the characters of all names sit back to back in one bump-allocated char array, no per-name
+          heap allocation, no std::string header; name i is [offset[i], offset[i+1])
+        > index: flat open addressing table (linear probing, power of two size, load <= 1/2) of
+          {32 bit hash, id, offset, length}; strings are compared only on a hash match, straight from
+          the slot's offset into the arena (a hit reads the slot line and the name's chars, not the
+          offset array)
+        > intern() of a name already present is a plain lookup, the table only grows on an insert
+        > per name: its characters + 4 bytes of offset + 32..64 bytes of index
+        > a string_view from name() is invalidated by the next intern() (the arena may grow), ids never are
+        > limited to 2^32 - 1 names and 4 GiB of characters
+    */
+    #include<cstdint>
+    #include<functional>
+    #include<stdexcept>
+    #include<string_view>
+    #include<vector>
+
+    class NameTable{
+        struct Slot{
+            std::uint32_t hash{};
+            std::uint32_t id{ npos};
+            std::uint32_t offset{};// the name's chars in m_chars
+            std::uint32_t length{};
+        };
+        std::vector<char> m_chars{};
+        std::vector<std::uint32_t> m_offsets{ 0};// size() + 1 entries
+        std::vector<Slot> m_slots{};
+    public:
+        static constexpr std::uint32_t npos{ 0xFFFFFFFFu};
+    private:
+        static std::uint32_t hashName(std::string_view name){
+            auto h{ static_cast<std::uint64_t>(std::hash<std::string_view>{}(name))};
+            return static_cast<std::uint32_t>(h ^ (h >> 32));
+        }
+        std::string_view slotName(const Slot & slot) const { return { m_chars.data() + slot.offset, slot.length};}
+        // slot holding `name`, or the empty slot where it would go
+        std::size_t probe(std::string_view name, std::uint32_t hash) const {
+            const std::size_t mask{ m_slots.size() - 1};
+            for(std::size_t i{ hash & mask};; i = (i + 1) & mask){
+                const Slot & slot{ m_slots[i]};
+                if(slot.id == npos || (slot.hash == hash && slotName(slot) == name))
+                    return i;
+            }
+        }
+        void rehash(std::size_t slotCount){
+            std::vector<Slot> old{ std::move(m_slots)};
+            m_slots.assign(slotCount, Slot{});
+            const std::size_t mask{ slotCount - 1};
+            for(const Slot & slot : old){// ids are distinct, no string compares needed
+                if(slot.id == npos)
+                    continue;
+                std::size_t i{ slot.hash & mask};
+                while(m_slots[i].id != npos)
+                    i = (i + 1) & mask;
+                m_slots[i] = slot;
+            }
+        }
+    public:
+        NameTable(){ rehash(16);}
+        void reserve(std::size_t names, std::size_t chars){
+            m_chars.reserve(chars);
+            m_offsets.reserve(names + 1);
+            std::size_t slots{ 16};
+            while(slots < names * 2)
+                slots *= 2;
+            if(slots > m_slots.size())
+                rehash(slots);
+        }
+        std::size_t size() const { return m_offsets.size() - 1;}
+        std::string_view name(std::uint32_t id) const {
+            return { m_chars.data() + m_offsets[id], m_offsets[id + 1] - m_offsets[id]};
+        }
+        std::uint32_t find(std::string_view name) const {
+            return m_slots[probe(name, hashName(name))].id;
+        }
+        // id of `name`, appended to the arena the first time it is seen (the new id is then size() - 1)
+        std::uint32_t intern(std::string_view name){
+            const std::uint32_t hash{ hashName(name)};
+            std::size_t i{ probe(name, hash)};
+            if(m_slots[i].id != npos)
+                return m_slots[i].id;
+            if(size() >= npos || m_chars.size() + name.size() > 0xFFFFFFFFu)
+                throw std::length_error{ "NameTable full"};
+            if((size() + 1) * 2 > m_slots.size()){// a new name: keep the load <= 1/2
+                rehash(m_slots.size() * 2);
+                i = probe(name, hash);
+            }
+            const auto offset{ static_cast<std::uint32_t>(m_chars.size())};
+            m_chars.insert(m_chars.end(), name.begin(), name.end());
+            m_offsets.push_back(static_cast<std::uint32_t>(m_chars.size()));
+            m_slots[i] = { hash, static_cast<std::uint32_t>(size() - 1), offset, static_cast<std::uint32_t>(name.size())};
+            return m_slots[i].id;
+        }
+        // gives back the slack left by the arena's doubling growth, e.g. after a bulk load
+        void shrinkToFit(){
+            m_chars.shrink_to_fit();
+            m_offsets.shrink_to_fit();
+        }
+        // heap bytes held (capacities, not sizes)
+        std::size_t memoryBytes() const {
+            return m_chars.capacity() + m_offsets.capacity() * sizeof(std::uint32_t) + m_slots.capacity() * sizeof(Slot);
+        }
+    };
+#endif
@@ -0,0 +1,92 @@
+#ifndef __PAIR_H
+#define __PAIR_H
+    /*
+        Pair & StringValuePair from TemplateExercise.cpp, built in place instead of copied in.
+        > Pair(first, second) forwards each argument to its member: a temporary or a string literal
+          is moved / converted straight into the member, no extra copy (the old const T1& constructor
+          always copied)
+        > Pair(std::piecewise_construct, std::forward_as_tuple(args1...), std::forward_as_tuple(args2...))
+          constructs each member from its own argument list, like std::pair
+        > empty member types (comparators, tags, stateless allocators) take no space: such a member is
+          a base class (empty base optimization), Pair<std::less<>, int> is the size of an int.
+          Final empty types can't be derived from and are stored as members
+        > copy, move & destructor are left to the compiler, so Pair<T1, T2> is trivially copyable
+          whenever T1 and T2 are (checked below for the usual cases): arrays and vectors of such pairs
+          are copied with memcpy/memmove, and copyPairs() does that explicitly
+        > StringValuePair inherits all Pair constructors: StringValuePair<int>{ "Hello", 5} builds the
+          std::string once from the literal
+    */
+    #include<cstring>
+    #include<functional>
+    #include<string>
+    #include<tuple>
+    #include<type_traits>
+    #include<utility>
+
+    // one member of a Pair; Index keeps the two apart when T1 and T2 are the same type
+    template<typename T, int Index, bool = std::is_empty_v<T> && !std::is_final_v<T>>
+    class PairElement{
+        T m_value{};
+    public:
+        PairElement() = default;
+        template<typename U>
+        PairElement(std::in_place_t, U && value) : m_value(std::forward<U>(value)){}
+        template<typename Tuple, std::size_t... I>
+        PairElement(Tuple & args, std::index_sequence<I...>) : m_value(std::get<I>(std::move(args))...){}
+        T & get(){ return m_value;}
+        const T & get() const { return m_value;}
+    };
+    template<typename T, int Index>
+    class PairElement<T, Index, true> : private T{
+    public:
+        PairElement() = default;
+        template<typename U>
+        PairElement(std::in_place_t, U && value) : T(std::forward<U>(value)){}
+        template<typename Tuple, std::size_t... I>
+        PairElement(Tuple & args, std::index_sequence<I...>) : T(std::get<I>(std::move(args))...){}
+        T & get(){ return *this;}
+        const T & get() const { return *this;}
+    };
+
+    template<class T1, class  T2>
+    class Pair : private PairElement<T1, 0>, private PairElement<T2, 1>{
+        using First = PairElement<T1, 0>;
+        using Second = PairElement<T2, 1>;
+    public:
+        Pair() = default;
+        Pair(const T1 & first, const T2 & second): First{ std::in_place, first}, Second{ std::in_place, second}{}
+        template<class U1, class U2, typename = std::enable_if_t<std::is_constructible_v<T1, U1 &&> && std::is_constructible_v<T2, U2 &&>>>
+        Pair(U1 && first, U2 && second): First{ std::in_place, std::forward<U1>(first)}, Second{ std::in_place, std::forward<U2>(second)}{}
+        template<class... Args1, class... Args2>
+        Pair(std::piecewise_construct_t, std::tuple<Args1...> first, std::tuple<Args2...> second)
+            : First{ first, std::index_sequence_for<Args1...>{}}, Second{ second, std::index_sequence_for<Args2...>{}}{}
+        T1 & first() { return First::get();}
+        T2 & second() { return Second::get();}
+        const T1 & first()   const { return First::get();}
+        const  T2 & second() const { return Second::get();}
+    };
+
+    template<class T>
+    class StringValuePair: public Pair<std::string, T>{
+    public :
+        using Pair<std::string, T>::Pair;
+    };
+
+    // n pairs from src to dst (not overlapping): one memcpy when the pairs are trivially copyable
+    template<class T1, class T2>
+    void copyPairs(const Pair<T1, T2> * src, std::size_t n, Pair<T1, T2> * dst){
+        if constexpr(std::is_trivially_copyable_v<Pair<T1, T2>>){
+            if(n)
+                std::memcpy(dst, src, n * sizeof(Pair<T1, T2>));
+        }else{
+            for(std::size_t i{}; i < n; ++i)
+                dst[i] = src[i];
+        }
+    }
+
+    static_assert(std::is_trivially_copyable_v<Pair<int, double>>);
+    static_assert(std::is_trivially_copyable_v<Pair<double, int>>);
+    static_assert(std::is_trivially_copyable_v<Pair<const char *, std::size_t>>);
+    static_assert(!std::is_trivially_copyable_v<StringValuePair<int>>);
+    static_assert(sizeof(Pair<std::less<>, int>) == sizeof(int));
+#endif
@@ -0,0 +1,142 @@
+/*
+    Pair / StringValuePair (Pair.h) vs the originals from TemplateExercise.cpp:
+    > heap allocations per construction, counted by replacing global operator new; fails if the new
+      pairs allocate more than the members themselves need
+    > size of a Pair with an empty member
+    > bulk copy of a million Pair<int, double>: element by element, copyPairs() (one memcpy) and
+      std::vector copy, next to a pair type that is not trivially copyable
+
+    build: g++ -std=c++17 -O2 PairBench.cpp
+    usage: PairBench [pairs] [repeats]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<cstdlib>
+#include<functional>
+#include<new>
+#include"Pair.h"
+
+static std::size_t g_allocations{};
+void * operator new(std::size_t size){
+    ++g_allocations;
+    if(void * p{ std::malloc(size ? size : 1)})
+        return p;
+    throw std::bad_alloc{};
+}
+void operator delete(void * p) noexcept { std::free(p);}
+void operator delete(void * p, std::size_t) noexcept { std::free(p);}
+
+// the originals
+template<class T1, class  T2>
+class LegacyPair{
+    T1 m_first;
+    T2 m_second;
+public:
+    LegacyPair(const T1 & first, const T2 & second): m_first{first}, m_second{second}{}
+    const T1 & first()   const { return m_first;}
+    const  T2 & second() const { return m_second;}
+};
+template<class T>
+class LegacyStringValuePair: public LegacyPair<std::string, T>{
+public :
+    LegacyStringValuePair(const std::string & first, const T & second)
+    : LegacyPair<std::string, T>{first, second}{}
+};
+// same layout as Pair<int, double>, but with a user-provided copy: no memcpy
+struct CopyingPair{
+    int first{};
+    double second{};
+    CopyingPair() = default;
+    CopyingPair(const CopyingPair & src) : first{src.first}, second{src.second}{}
+    CopyingPair & operator=(const CopyingPair & src){ first = src.first; second = src.second; return *this;}
+};
+
+template<typename Func>
+std::size_t allocationsOf(Func && func){
+    const std::size_t before{ g_allocations};
+    func();
+    return g_allocations - before;
+}
+template<typename Func>
+double nsPer(std::size_t count, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(count);
+}
+bool check(const char * what, std::size_t legacy, std::size_t now, std::size_t expected){
+    std::cout<<"  "<<what<<": "<<legacy<<" -> "<<now<<"\n";
+    return now == expected;
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int repeats{ argc > 2 ? std::stoi(argv[2]) : 20};
+    bool ok{ true};
+
+    // long enough to be past the small string buffer
+    const char * literal{ "a key that does not fit in the small string buffer"};
+    std::cout<<"heap allocations per construction, original -> Pair.h\n";
+    ok = check("StringValuePair from a string literal", allocationsOf([&]{ LegacyStringValuePair<int> p{ literal, 5};}),
+               allocationsOf([&]{ StringValuePair<int> p{ literal, 5};}), 1) && ok;
+    ok = check("StringValuePair from a std::string temporary", allocationsOf([&]{ std::string key{ literal}; LegacyStringValuePair<int> p{ std::move(key), 5};}),
+               allocationsOf([&]{ std::string key{ literal}; StringValuePair<int> p{ std::move(key), 5};}), 1) && ok;
+    ok = check("Pair<std::string, std::vector<int>> from temporaries",
+               allocationsOf([&]{ LegacyPair<std::string, std::vector<int>> p{ std::string{ literal}, std::vector<int>(100)};}),
+               allocationsOf([&]{ Pair<std::string, std::vector<int>> p{ std::string{ literal}, std::vector<int>(100)};}), 2) && ok;
+    ok = check("Pair<std::string, std::vector<int>> piecewise",
+               allocationsOf([&]{ LegacyPair<std::string, std::vector<int>> p{ std::string(60, 'x'), std::vector<int>(100, 1)};}),
+               allocationsOf([&]{ Pair<std::string, std::vector<int>> p{ std::piecewise_construct, std::forward_as_tuple(60, 'x'),
+                                                                         std::forward_as_tuple(100, 1)};}), 2) && ok;
+    {
+        StringValuePair<int> p{ literal, 5};
+        ok = ok && p.first() == literal && p.second() == 5;
+        ok = check("copy of a StringValuePair", 1, allocationsOf([&]{ StringValuePair<int> copy{ p}; ok = ok && copy.first() == literal;}), 1) && ok;
+    }
+
+    std::cout<<"sizeof with an empty member, original -> Pair.h\n"
+             <<"  <std::less<>, int>: "<<sizeof(LegacyPair<std::less<>, int>)<<" -> "<<sizeof(Pair<std::less<>, int>)<<"\n"
+             <<"  <std::hash<int>, double>: "<<sizeof(LegacyPair<std::hash<int>, double>)<<" -> "<<sizeof(Pair<std::hash<int>, double>)<<"\n";
+    ok = ok && sizeof(Pair<std::less<>, int>) == sizeof(int) && sizeof(Pair<std::hash<int>, double>) == sizeof(double);
+
+    std::vector<Pair<int, double>> src(count), dst(count);
+    for(std::size_t i{}; i < count; ++i)
+        src[i] = { static_cast<int>(i), i * 0.5};
+    std::vector<CopyingPair> copyingSrc(count), copyingDst(count);
+    const std::size_t total{ count * static_cast<std::size_t>(repeats)};
+    std::cout<<"bulk copy of "<<count<<" pairs of "<<sizeof(Pair<int, double>)<<" bytes, ns per pair\n";
+    double loop{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r){
+            Pair<int, double> * __restrict out{ dst.data()};
+            for(std::size_t i{}; i < count; ++i){
+                out[i].first() = src[i].first();
+                out[i].second() = src[i].second();
+            }
+            ok = ok && dst.back().first() == src.back().first();
+        }
+    })};
+    double copying{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r){
+            std::copy(copyingSrc.begin(), copyingSrc.end(), copyingDst.begin());
+            ok = ok && copyingDst.back().first == copyingSrc.back().first;
+        }
+    })};
+    double memcpyPath{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r){
+            copyPairs(src.data(), count, dst.data());
+            ok = ok && dst.back().first() == src.back().first();
+        }
+    })};
+    double vectorCopy{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r){
+            std::vector<Pair<int, double>> copy{ src};
+            ok = ok && copy.back().first() == src.back().first();
+        }
+    })};
+    std::cout<<"  member by member          : "<<loop<<"\n"
+             <<"  not trivially copyable    : "<<copying<<"\n"
+             <<"  copyPairs (memcpy)        : "<<memcpyPath<<"\n"
+             <<"  std::vector copy (alloc'd): "<<vectorCopy<<"\n";
+    std::cout<<(ok ? "checks passed\n" : "CHECK FAILED\n");
+    return ok ? 0 : 1;
+}
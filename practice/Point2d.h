@@ -0,0 +1,24 @@
+#ifndef __POINT2D_H
+#define __POINT2D_H
+    // Point2d from PointGame.cpp; shared with the batch kernels in PointCloud.h
+    #include<cmath>
+    #include<iostream>
+    class Point2d{
+        double m_x{};
+        double m_y{};
+    public:
+        Point2d(double x =0.0, double y= 0.0 ):m_x(x), m_y(y){}
+        double getX() const { return m_x;}
+        double getY() const { return m_y;}
+        void print() const{
+            std::cout<<"Point2d("<<m_x<<", "<<m_y<<")\n";
+        }
+        double distanceTo(const Point2d & other)const{
+            return (std::sqrt((m_x - other.m_x)*(m_x - other.m_x) + (m_y - other.m_y)*(m_y - other.m_y)));
+        }
+        friend double distanceFrom(const Point2d & first, const Point2d & second);
+    };
+    inline double distanceFrom(const Point2d & first, const Point2d & second){
+        return (std::sqrt((first.m_x - second.m_x)*(first.m_x - second.m_x) + (first.m_y - second.m_y)*(first.m_y - second.m_y)));
+    }
+#endif
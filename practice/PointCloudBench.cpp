@@ -0,0 +1,98 @@
+/*
+    PointCloud (PointCloud.h) batch kernels vs a Point2d::distanceTo call per point over a
+    std::vector<Point2d>: throughput in points/sec, results checked against distanceTo.
+
+    build: g++ -std=c++17 -O3 -march=native -fno-math-errno PointCloudBench.cpp
+    usage: PointCloudBench [points] [queries] [k]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<cmath>
+#include<algorithm>
+#include"PointCloud.h"
+#include"Random.h"
+
+template<typename Func>
+double pointsPerSec(std::size_t points, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+    return points / elapsed.count();
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 4'000'000};
+    std::size_t queries{ argc > 2 ? std::stoul(argv[2]) : 20};
+    std::size_t k{ argc > 3 ? std::stoul(argv[3]) : 16};
+    if(count == 0 || queries == 0 || k == 0){// nearest(q, 0) has no front(), out[0] needs a point
+        std::cerr<<"usage: PointCloudBench [points > 0] [queries > 0] [k > 0]\n";
+        return 1;
+    }
+
+    Random rng{ 7};
+    std::vector<Point2d> points(count);
+    for(auto & point : points)
+        point = { rng.getDouble() * 1000.0, rng.getDouble() * 1000.0};
+    std::vector<Point2d> from(queries);
+    for(auto & point : from)
+        point = { rng.getDouble() * 1000.0, rng.getDouble() * 1000.0};
+    const PointCloud cloud{ points};
+    std::vector<double> out(count);
+
+    // validation: every batch distance against distanceTo (a fused multiply-add may differ in the last bit)
+    bool ok{ true};
+    double worst{};
+    for(const auto & q : from){
+        cloud.distances(q, out.data());
+        for(std::size_t i{}; i < count; ++i){
+            const double expected{ q.distanceTo(points[i])};
+            worst = std::max(worst, std::fabs(out[i] - expected) / std::max(expected, 1e-300));
+        }
+        cloud.squaredDistances(q, out.data());
+        std::vector<double> sorted(count);
+        for(std::size_t i{}; i < count; ++i)
+            sorted[i] = q.distanceTo(points[i]);
+        std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(std::min(k, count) - 1), sorted.end());
+        auto nearest{ cloud.nearest(q, k)};
+        const double kth{ sorted[std::min(k, count) - 1]};
+        ok = ok && nearest.size() == std::min(k, count)
+            && std::fabs(q.distanceTo(points[nearest.back().index]) - kth) <= 1e-12 * kth
+            && std::is_sorted(nearest.begin(), nearest.end(), [](auto & a, auto & b){ return a.squaredDistance < b.squaredDistance;});
+        std::size_t within{ cloud.countWithin(q, 50.0)};
+        std::size_t expectedWithin{ static_cast<std::size_t>(std::count_if(points.begin(), points.end(),
+            [&q](const Point2d & p){ return q.distanceTo(p) <= 50.0;}))};
+        // a point exactly on the circle may land either side of sqrt's rounding
+        ok = ok && (within > expectedWithin ? within - expectedWithin : expectedWithin - within) <= 1;
+    }
+    ok = ok && worst <= 2.3e-16;
+    std::cout<<count<<" points, "<<queries<<" query points; max relative difference from distanceTo "<<worst<<"\n";
+
+    double sink{};
+    const std::size_t total{ count * queries};
+    std::cout<<"M points/sec:\n  Point2d::distanceTo loop : "<<pointsPerSec(total, [&]{
+        for(const auto & q : from)
+            for(std::size_t i{}; i < count; ++i)
+                out[i] = q.distanceTo(points[i]);
+        sink += out[0];
+    }) / 1e6<<"\n";
+    std::cout<<"  PointCloud::distances   : "<<pointsPerSec(total, [&]{
+        for(const auto & q : from)
+            cloud.distances(q, out.data());
+        sink += out[0];
+    }) / 1e6<<"\n";
+    std::cout<<"  squaredDistances        : "<<pointsPerSec(total, [&]{
+        for(const auto & q : from)
+            cloud.squaredDistances(q, out.data());
+        sink += out[0];
+    }) / 1e6<<"\n";
+    std::cout<<"  countWithin             : "<<pointsPerSec(total, [&]{
+        for(const auto & q : from)
+            sink += cloud.countWithin(q, 50.0);
+    }) / 1e6<<"\n";
+    std::cout<<"  nearest (k = "<<k<<")        : "<<pointsPerSec(total, [&]{
+        for(const auto & q : from)
+            sink += cloud.nearest(q, k).front().squaredDistance;
+    }) / 1e6<<"\n";
+    std::cout<<(ok ? "results match distanceTo\n" : "MISMATCH\n")<<(sink == 0.5 ? " " : "");
+    return ok ? 0 : 1;
+}
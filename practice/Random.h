@@ -0,0 +1,114 @@
+#ifndef __RANDOM_H
+#define __RANDOM_H
+
+    #include<atomic>
+    #include<cstdint>
+    /*
+        Splittable random number generator (SplitMix64, the scheme behind Java's SplittableRandom)
+        replacing std::rand()/std::srand(): no hidden global state, no locks, unbiased ranges.
+
+        > a generator is a pair (state, gamma); next() = mix64(state += gamma). gamma is odd,
+          so every generator walks all 2^64 states before repeating.
+        > stream splitting:
+            - forStream(seed, k) : stream k of a seed starts at state mix64(seed + k * golden) with
+              gamma mixGamma(mix64(seed) + k * golden). Any worker can build stream k by itself, so
+              run/entity k gets the same numbers whichever thread (and however many threads) runs it.
+            - split()            : child generator seeded from two draws of the parent (one for state,
+              one for gamma); use it to hand sub-tasks their own independent stream.
+            - counterNext(seed, counter) : stateless, the counter-th value of the seed; for bulk fills
+              where each element is addressed by index.
+        > every thread owns a thread_local generator (threadRandom()). Threads that never call
+          seedThreadRandom() take streams 0, 1, 2, ... of the global seed in the order they first draw.
+          For reproducible multi-threaded runs give each work item an explicit stream instead.
+    */
+    class Random{
+        std::uint64_t m_state{};
+        std::uint64_t m_gamma{};
+    public:
+        static constexpr std::uint64_t goldenGamma{ 0x9E3779B97F4A7C15ULL };
+
+        static constexpr std::uint64_t mix64(std::uint64_t z){
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+        // gammas need to be odd and have enough 0-1 transitions to mix well
+        static constexpr std::uint64_t mixGamma(std::uint64_t z){
+            z = mix64(z) | 1ULL;
+            int transitions{ __builtin_popcountll(z ^ (z >> 1)) };
+            return (transitions < 24) ? z ^ 0xAAAAAAAAAAAAAAAAULL : z;
+        }
+        static constexpr std::uint64_t counterNext(std::uint64_t seed, std::uint64_t counter){
+            return mix64(seed + (counter + 1) * goldenGamma);
+        }
+        // [min, max] from a counter value; multiply-shift, bias at most (max-min+1)/2^32
+        static constexpr int counterInt(std::uint64_t seed, std::uint64_t counter, int min, int max){
+            auto range{ static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min + 1) };
+            // offset <= range - 1, so min + offset fits an int; adding in 64 bits keeps the full
+            // [INT_MIN, INT_MAX] range (offset up to 2^32 - 1) from overflowing
+            const std::uint64_t offset{ ((counterNext(seed, counter) >> 32) * range) >> 32 };
+            return static_cast<int>(min + static_cast<std::int64_t>(offset));
+        }
+
+        explicit constexpr Random(std::uint64_t seed = 0) : Random{ forStream(seed, 0) } {}
+        constexpr Random(std::uint64_t state, std::uint64_t gamma) : m_state{state}, m_gamma{gamma | 1ULL} {}
+        static constexpr Random forStream(std::uint64_t seed, std::uint64_t stream){
+            return { mix64(seed + stream * goldenGamma), mixGamma(mix64(seed) + stream * goldenGamma) };
+        }
+        Random split(){
+            auto state{ next() };
+            return { state, mixGamma(next()) };
+        }
+
+        std::uint64_t next(){ return mix64(m_state += m_gamma); }
+        std::uint32_t next32(){ return static_cast<std::uint32_t>(next() >> 32); }
+        // unbiased integer in [min, max] (Lemire's multiply-shift with rejection)
+        int getInt(int min, int max){
+            auto range{ static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min + 1) };
+            if(range == 0) // full 32 bit range
+                return static_cast<int>(next32());
+            std::uint64_t m{ static_cast<std::uint64_t>(next32()) * range };
+            auto low{ static_cast<std::uint32_t>(m) };
+            if(low < range){
+                const std::uint32_t threshold{ (0u - range) % range };
+                while(low < threshold){
+                    m = static_cast<std::uint64_t>(next32()) * range;
+                    low = static_cast<std::uint32_t>(m);
+                }
+            }
+            return static_cast<int>(min + static_cast<std::int64_t>(m >> 32));
+        }
+        // [0, 1)
+        double getDouble(){ return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+        // raw state, so snapshots can save & restore a generator exactly
+        std::uint64_t getState() const { return m_state; }
+        std::uint64_t getGamma() const { return m_gamma; }
+    };
+
+    inline std::atomic<std::uint64_t> g_randomSeed{ 0 };
+    inline std::atomic<std::uint64_t> g_nextRandomStream{ 0 };
+
+    // per-thread generator; lock free, the only shared state is one fetch_add on first use
+    inline Random & threadRandom(){
+        thread_local Random rng{ Random::forStream(g_randomSeed.load(std::memory_order_relaxed),
+                                                   g_nextRandomStream.fetch_add(1, std::memory_order_relaxed)) };
+        return rng;
+    }
+    // put the calling thread on stream `stream` of `seed`
+    inline void seedThreadRandom(std::uint64_t seed, std::uint64_t stream){
+        threadRandom() = Random::forStream(seed, stream);
+    }
+    // replaces std::srand(): sets the global seed, restarts stream numbering and makes the
+    // calling thread stream 0. Threads started afterwards take streams 1, 2, ...
+    inline void seedRandom(std::uint64_t seed){
+        Random & rng{ threadRandom() }; // first use claims a stream number, do it before the reset
+        g_randomSeed.store(seed, std::memory_order_relaxed);
+        g_nextRandomStream.store(1, std::memory_order_relaxed);
+        rng = Random::forStream(seed, 0);
+    }
+    // replaces std::rand() based getRandomNumber(min, max)
+    inline int randomInt(int min, int max){
+        return threadRandom().getInt(min, max);
+    }
+#endif
@@ -0,0 +1,190 @@
+#ifndef __RATIONAL_H
+#define __RATIONAL_H
+    /*
+        Normalized fraction, the grown-up version of Fraction in overloadingExamples.cpp.
+        Fraction never reduces, so Fraction{1,2}*Fraction{2,3}*Fraction{3,4} keeps growing until int overflows
+        without a word. Rational<Int>:
+        > always normalized: den > 0 and gcd(|num|, den) == 1, reduced with binary GCD
+        > multiply cross-cancels first (gcd(a.num, b.den), gcd(b.num, a.den)), add divides by gcd of the
+          denominators first, so intermediates stay as small as the result allows
+        > every multiply/add is overflow checked: tryMultiply/tryAdd return Expected (see Expected.h),
+          the operators throw std::overflow_error
+        > Rational64 (std::int64_t) and Rational128 (__int128, GCC/Clang)
+        > no array/batch versions: the reduction GCD is a data dependent loop per element, and neither a
+          screened single reduction nor lockstep GCDs over several elements beat the scalar ops
+    */
+    #include<cstdint>
+    #include<cstddef>
+    #include<limits>
+    #include<ostream>
+    #include<stdexcept>
+    #include<string>
+    #include<type_traits>
+    #include"Expected.h"
+
+    enum class RationalError : std::uint8_t{
+        divideByZero,
+        overflow,
+    };
+
+    namespace rational_detail{
+        template<typename U>
+        int countTrailingZeros(U x){
+            if constexpr(sizeof(U) > sizeof(unsigned long long)){
+                auto low{ static_cast<unsigned long long>(x)};
+                return low ? __builtin_ctzll(low) : 64 + __builtin_ctzll(static_cast<unsigned long long>(x >> 64));
+            }else{
+                return __builtin_ctzll(x);
+            }
+        }
+        // Stein's binary GCD: shifts & subtractions only, no division
+        template<typename U>
+        U binaryGcd(U a, U b){
+            if(a == 0) return b;
+            if(b == 0) return a;
+            const int shift{ countTrailingZeros(a | b)};
+            a >>= countTrailingZeros(a);
+            do{
+                b >>= countTrailingZeros(b);
+                if(a > b){
+                    U t{ a};
+                    a = b;
+                    b = t;
+                }
+                b -= a;
+            }while(b != 0);
+            return a << shift;
+        }
+        template<typename Int>
+        struct MakeUnsigned{ using type = std::make_unsigned_t<Int>;};
+        template<>
+        struct MakeUnsigned<__int128>{ using type = unsigned __int128;};
+        template<typename Int>
+        using Unsigned = typename MakeUnsigned<Int>::type;
+
+        template<typename Int>
+        constexpr Int maxValue(){
+            if constexpr(std::is_same_v<Int, __int128>)
+                return static_cast<Int>(~static_cast<unsigned __int128>(0) >> 1);
+            else
+                return std::numeric_limits<Int>::max();
+        }
+        template<typename Int>
+        Unsigned<Int> absolute(Int x){
+            return x < 0 ? Unsigned<Int>(0) - static_cast<Unsigned<Int>>(x) : static_cast<Unsigned<Int>>(x);
+        }
+        template<typename Int>
+        Int gcd(Int a, Int b){
+            return static_cast<Int>(binaryGcd(absolute(a), absolute(b)));
+        }
+    }
+
+    template<typename Int>
+    class Rational{
+        Int m_num{ 0};
+        Int m_den{ 1};
+        struct Normalized{};// tag: arguments are already reduced
+        constexpr Rational(Int num, Int den, Normalized) : m_num{num}, m_den{den}{}
+
+        // the minimum value has no positive counterpart, keep it out so negation never overflows
+        static bool inRange(Int x){ return x >= -rational_detail::maxValue<Int>();}
+        static bool mul(Int a, Int b, Int & out){ return !__builtin_mul_overflow(a, b, &out) && inRange(out);}
+        static bool add(Int a, Int b, Int & out){ return !__builtin_add_overflow(a, b, &out) && inRange(out);}
+    public:
+        constexpr Rational() = default;
+        Rational(Int num, Int den = 1){
+            auto r{ make(num, den)};
+            if(!r)
+                throw std::domain_error{ "Rational: zero denominator or value out of range"};
+            *this = *r;
+        }
+        static Expected<Rational, RationalError> make(Int num, Int den){
+            if(den == 0)
+                return unexpected(RationalError::divideByZero);
+            if(!inRange(num) || !inRange(den))
+                return unexpected(RationalError::overflow);
+            if(den < 0){
+                num = -num;
+                den = -den;
+            }
+            const Int g{ rational_detail::gcd(num, den)};
+            return Rational{ num / g, den / g, Normalized{}};
+        }
+        Int num() const { return m_num;}
+        Int den() const { return m_den;}
+
+        friend Expected<Rational, RationalError> tryMultiply(const Rational & a, const Rational & b){
+            const Int g1{ rational_detail::gcd(a.m_num, b.m_den)};
+            const Int g2{ rational_detail::gcd(b.m_num, a.m_den)};
+            Int num{}, den{};
+            if(!mul(a.m_num / g1, b.m_num / g2, num) || !mul(a.m_den / g2, b.m_den / g1, den))
+                return unexpected(RationalError::overflow);
+            return Rational{ num, den, Normalized{}};
+        }
+        friend Expected<Rational, RationalError> tryDivide(const Rational & a, const Rational & b){
+            if(b.m_num == 0)
+                return unexpected(RationalError::divideByZero);
+            const Rational inverse{ b.m_num < 0 ? -b.m_den : b.m_den, b.m_num < 0 ? -b.m_num : b.m_num, Normalized{}};
+            return tryMultiply(a, inverse);
+        }
+        // Knuth's: num = a.num*(b.den/g) + b.num*(a.den/g) with g = gcd(a.den, b.den);
+        // only gcd(num, g) can still be common with the denominator
+        friend Expected<Rational, RationalError> tryAdd(const Rational & a, const Rational & b){
+            const Int g{ rational_detail::gcd(a.m_den, b.m_den)};
+            Int left{}, right{}, num{};
+            if(!mul(a.m_num, b.m_den / g, left) || !mul(b.m_num, a.m_den / g, right) || !add(left, right, num))
+                return unexpected(RationalError::overflow);
+            const Int g2{ num == 0 ? g : rational_detail::gcd(num, g)};
+            Int den{};
+            if(!mul(a.m_den / g, b.m_den / g2, den))
+                return unexpected(RationalError::overflow);
+            if(num == 0)
+                return Rational{};
+            return Rational{ num / g2, den, Normalized{}};
+        }
+        friend Expected<Rational, RationalError> trySubtract(const Rational & a, const Rational & b){
+            return tryAdd(a, -b);
+        }
+
+        Rational operator-() const { return { -m_num, m_den, Normalized{}};}
+        friend Rational operator*(const Rational & a, const Rational & b){ return orThrow(tryMultiply(a, b));}
+        friend Rational operator/(const Rational & a, const Rational & b){ return orThrow(tryDivide(a, b));}
+        friend Rational operator+(const Rational & a, const Rational & b){ return orThrow(tryAdd(a, b));}
+        friend Rational operator-(const Rational & a, const Rational & b){ return orThrow(trySubtract(a, b));}
+        Rational & operator*=(const Rational & other){ return *this = *this * other;}
+        Rational & operator+=(const Rational & other){ return *this = *this + other;}
+        // normalized form is unique, so equality is memberwise
+        friend bool operator==(const Rational & a, const Rational & b){ return a.m_num == b.m_num && a.m_den == b.m_den;}
+        friend bool operator!=(const Rational & a, const Rational & b){ return !(a == b);}
+
+        double toDouble() const { return static_cast<double>(m_num) / static_cast<double>(m_den);}
+        friend std::ostream & operator<<(std::ostream & out, const Rational & r){
+            out<<toString(r.m_num)<<"/"<<toString(r.m_den);
+            return out;
+        }
+    private:
+        static Rational orThrow(const Expected<Rational, RationalError> & result){
+            if(!result){
+                if(result.error() == RationalError::divideByZero)
+                    throw std::domain_error{ "Rational division by zero"};
+                throw std::overflow_error{ "Rational overflow"};
+            }
+            return *result;
+        }
+        static std::string toString(Int x){
+            if constexpr(std::is_same_v<Int, __int128>){
+                auto u{ rational_detail::absolute(x)};
+                std::string digits{};
+                do{
+                    digits.insert(digits.begin(), static_cast<char>('0' + static_cast<int>(u % 10)));
+                    u /= 10;
+                }while(u != 0);
+                return x < 0 ? "-" + digits : digits;
+            }else{
+                return std::to_string(x);
+            }
+        }
+    };
+    using Rational64 = Rational<std::int64_t>;
+    using Rational128 = Rational<__int128>;
+#endif
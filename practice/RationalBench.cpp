@@ -0,0 +1,103 @@
+/*
+    Long product chains: unreduced int fraction (what Fraction in overloadingExamples.cpp does)
+    vs normalized Rational64 / Rational128 (Rational.h), plus multiply/add of independent pairs.
+
+    build: g++ -std=c++17 -O2 RationalBench.cpp
+    usage: RationalBench [chainLength] [pairs]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<string>
+#include"Rational.h"
+#include"Random.h"
+
+// Fraction's operator*: multiply numerators & denominators, never reduce
+struct RawFraction{
+    int num{};
+    int den{ 1};
+};
+template<typename Func>
+double nsPer(std::size_t count, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count() / count;
+}
+int main(int argc, char * argv[]){
+    std::size_t chain{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    std::size_t batch{ argc > 2 ? std::stoul(argv[2]) : 1'000'000};
+
+    // 1/2 * 2/3 * 3/4 * ... = 1/(n+1)
+    std::cout<<"telescoping chain 1/2 * 2/3 * ... of length "<<chain<<"\n";
+    RawFraction raw{ 1, 1};
+    std::size_t rawCorrect{};
+    for(std::size_t k{1}; k <= chain; ++k){
+        long long num{ static_cast<long long>(raw.num) * static_cast<long long>(k)};
+        long long den{ static_cast<long long>(raw.den) * static_cast<long long>(k + 1)};
+        if(num != static_cast<int>(num) || den != static_cast<int>(den))
+            break;
+        raw = { static_cast<int>(num), static_cast<int>(den)};
+        rawCorrect = k;
+    }
+    std::cout<<"  unreduced int Fraction overflows after "<<rawCorrect<<" factors ("<<raw.num<<"/"<<raw.den<<")\n";
+
+    Rational64 p64{ 1};
+    double ns64{ nsPer(chain, [&]{
+        for(std::size_t k{1}; k <= chain; ++k)
+            p64 *= Rational64{ static_cast<std::int64_t>(k), static_cast<std::int64_t>(k + 1)};
+    })};
+    std::cout<<"  Rational64 : "<<p64<<", "<<ns64<<" ns/multiply\n";
+    Rational128 p128{ 1};
+    double ns128{ nsPer(chain, [&]{
+        for(std::size_t k{1}; k <= chain; ++k)
+            p128 *= Rational128{ static_cast<__int128>(k), static_cast<__int128>(k + 1)};
+    })};
+    std::cout<<"  Rational128: "<<p128<<", "<<ns128<<" ns/multiply\n";
+
+    // random chain: the exact product outgrows 64 bits eventually; find where each type reports it
+    Random rng{ 3};
+    std::vector<std::pair<int, int>> factors(chain);
+    for(auto & f : factors)
+        f = { rng.getInt(1, 50), rng.getInt(1, 50)};
+    std::size_t steps64{}, steps128{};
+    Rational64 r64{ 1};
+    for(const auto & [n, d] : factors){
+        auto next{ tryMultiply(r64, Rational64{ n, d})};
+        if(!next) break;
+        r64 = *next;
+        ++steps64;
+    }
+    Rational128 r128{ 1};
+    for(const auto & [n, d] : factors){
+        auto next{ tryMultiply(r128, Rational128{ n, d})};
+        if(!next) break;
+        r128 = *next;
+        ++steps128;
+    }
+    std::cout<<"random factors in [1,50]/[1,50]: overflow detected after "<<steps64<<" (64 bit) and "
+             <<steps128<<" (128 bit) steps\n";
+
+    // independent pairs: no dependency chain, so the time of one normalized multiply / add
+    std::vector<Rational64> a(batch), b(batch), product(batch), sum(batch);
+    for(std::size_t i{}; i < batch; ++i){
+        a[i] = Rational64{ rng.getInt(-10000, 10000), rng.getInt(1, 10000)};
+        b[i] = Rational64{ rng.getInt(-10000, 10000), rng.getInt(1, 10000)};
+    }
+    double mulNs{ nsPer(batch, [&]{
+        for(std::size_t i{}; i < batch; ++i)
+            product[i] = a[i] * b[i];
+    })};
+    double addNs{ nsPer(batch, [&]{
+        for(std::size_t i{}; i < batch; ++i)
+            sum[i] = a[i] + b[i];
+    })};
+    // cross-multiplied check, exact in 64 bits for these magnitudes
+    bool ok{ true};
+    for(std::size_t i{}; i < batch; ++i){
+        ok = ok && product[i].num() * a[i].den() * b[i].den() == a[i].num() * b[i].num() * product[i].den();
+        ok = ok && sum[i].num() * a[i].den() * b[i].den() == (a[i].num() * b[i].den() + b[i].num() * a[i].den()) * sum[i].den();
+    }
+    std::cout<<batch<<" pairs: multiply "<<mulNs<<" ns, add "<<addNs<<" ns"<<(ok ? "" : "  MISMATCH")<<"\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+#ifndef __SHAPE_H
+#define __SHAPE_H
+    /*
+        Point, Shape, Circle & Triangle from VirtualFunctionPractice.cpp, shared with ShapeList.h.
+        > accept(ShapeVisitor&) gives code holding Shape* a way to get at the concrete type with one
+          virtual call (double dispatch). Circle & Triangle are final, so calls made on them directly
+          (e.g. from ShapeList) are not virtual
+        > type queries without RTTI: every Shape carries its Shape::Kind, set once by the derived
+          class's constructor. isa<T>(shape) is one compare of that byte, shape_cast<T> / dyn_cast<T>
+          are that compare plus a static_cast (nullptr on mismatch, like dynamic_cast on pointers),
+          cast<T> asserts. Works with -fno-rtti. A new shape adds an enumerator and `static constexpr
+          Kind kind` in its class
+        > area(), perimeter() & boundingBox() per object, one virtual call each. A Circle lies in the
+          plane z = center z; a Triangle's area is half the length of the cross product of two edges.
+          For many shapes at once see ShapeBatch.h, which must compute the same values
+    */
+    #include<algorithm>
+    #include<cassert>
+    #include<cmath>
+    #include<cstdint>
+    #include<iostream>
+    class Point{
+        int m_x{};
+        int m_y{};
+        int m_z{};
+    public:
+        Point(int x=0, int y=0, int z=0): m_x{x}, m_y{y}, m_z{z}{}
+        int getX() const { return m_x;}
+        int getY() const { return m_y;}
+        int getZ() const { return m_z;}
+        friend std::ostream& operator<<(std::ostream & out, const Point & p) {
+            out<<"Point ("<<p.m_x<<", "<<p.m_y<<", "<<p.m_z<<") ";
+            return out;
+        }
+    };
+    // axis aligned, both corners included
+    struct BoundingBox{
+        Point min{};
+        Point max{};
+    };
+    class Circle;
+    class Triangle;
+    class ShapeVisitor{
+    public:
+        virtual void visit(const Circle & circle) = 0;
+        virtual void visit(const Triangle & triangle) = 0;
+        virtual ~ShapeVisitor(){}
+    };
+    class Shape{
+    public:
+        enum class Kind : std::uint8_t{
+            circle,
+            triangle,
+        };
+    private:
+        Kind m_kind;
+    protected:
+        explicit Shape(Kind kind) : m_kind{kind}{}
+    public:
+        Kind getKind() const { return m_kind;}
+        virtual std::ostream& print(std::ostream& out) const = 0;
+        virtual void accept(ShapeVisitor & visitor) const = 0;
+        virtual double area() const = 0;
+        virtual double perimeter() const = 0;
+        virtual BoundingBox boundingBox() const = 0;
+        friend std::ostream & operator<<(std::ostream & out, const Shape  & shape){
+           return shape.print(out);
+        }
+        virtual ~Shape(){}
+    };
+
+    class Circle final : public Shape{
+        Point m_center{};
+        int m_radius{};
+    public:
+        static constexpr Kind kind{ Kind::circle};
+        static constexpr double pi{ 3.14159265358979323846};
+        Circle(const Point & center , int r):Shape{kind}, m_center{center}, m_radius{r}{};
+        virtual std::ostream& print(std::ostream & out) const override{
+            out<<"Circle ( "<<m_center<<", radius "<<m_radius<<"\n";
+            return out;
+        }
+        void accept(ShapeVisitor & visitor) const override { visitor.visit(*this);}
+        double area() const override { return pi * m_radius * m_radius;}
+        double perimeter() const override { return 2.0 * pi * m_radius;}
+        BoundingBox boundingBox() const override {
+            return { Point{ m_center.getX() - m_radius, m_center.getY() - m_radius, m_center.getZ()},
+                     Point{ m_center.getX() + m_radius, m_center.getY() + m_radius, m_center.getZ()}};
+        }
+        const Point & getCenter() const { return m_center;}
+        int getRadius() const { return m_radius;}
+    };
+    class Triangle final : public Shape{
+        Point m_p1{};
+        Point m_p2{};
+        Point m_p3{};
+    public:
+        static constexpr Kind kind{ Kind::triangle};
+        Triangle(const Point & p1, const Point & p2, const Point & p3): Shape{kind}, m_p1{p1}, m_p2{p2}, m_p3{p3}{}
+         virtual std::ostream & print(std::ostream & out) const override{
+            out<<"Triangle ( "<<m_p1<<", "<<m_p2<<", "<<m_p3<<" )\n";
+            return out;
+         }
+        void accept(ShapeVisitor & visitor) const override { visitor.visit(*this);}
+        double area() const override {
+            const double ux{ static_cast<double>(m_p2.getX()) - m_p1.getX()};
+            const double uy{ static_cast<double>(m_p2.getY()) - m_p1.getY()};
+            const double uz{ static_cast<double>(m_p2.getZ()) - m_p1.getZ()};
+            const double vx{ static_cast<double>(m_p3.getX()) - m_p1.getX()};
+            const double vy{ static_cast<double>(m_p3.getY()) - m_p1.getY()};
+            const double vz{ static_cast<double>(m_p3.getZ()) - m_p1.getZ()};
+            const double cx{ uy * vz - uz * vy};
+            const double cy{ uz * vx - ux * vz};
+            const double cz{ ux * vy - uy * vx};
+            return 0.5 * std::sqrt(cx * cx + cy * cy + cz * cz);
+        }
+        double perimeter() const override { return edge(m_p1, m_p2) + edge(m_p2, m_p3) + edge(m_p3, m_p1);}
+        BoundingBox boundingBox() const override {
+            return { Point{ std::min({ m_p1.getX(), m_p2.getX(), m_p3.getX()}), std::min({ m_p1.getY(), m_p2.getY(), m_p3.getY()}),
+                           std::min({ m_p1.getZ(), m_p2.getZ(), m_p3.getZ()})},
+                     Point{ std::max({ m_p1.getX(), m_p2.getX(), m_p3.getX()}), std::max({ m_p1.getY(), m_p2.getY(), m_p3.getY()}),
+                           std::max({ m_p1.getZ(), m_p2.getZ(), m_p3.getZ()})}};
+        }
+        static double edge(const Point & a, const Point & b){
+            const double dx{ static_cast<double>(b.getX()) - a.getX()};
+            const double dy{ static_cast<double>(b.getY()) - a.getY()};
+            const double dz{ static_cast<double>(b.getZ()) - a.getZ()};
+            return std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+        const Point & getP1() const { return m_p1;}
+        const Point & getP2() const { return m_p2;}
+        const Point & getP3() const { return m_p3;}
+    };
+
+    template<typename T>
+    bool isa(const Shape & shape){ return shape.getKind() == T::kind;}
+    template<typename T>
+    bool isa(const Shape * shape){ return shape && isa<T>(*shape);}
+    template<typename T>
+    T * shape_cast(Shape * shape){ return isa<T>(shape) ? static_cast<T *>(shape) : nullptr;}
+    template<typename T>
+    const T * shape_cast(const Shape * shape){ return isa<T>(shape) ? static_cast<const T *>(shape) : nullptr;}
+    template<typename T>
+    T * dyn_cast(Shape * shape){ return shape_cast<T>(shape);}
+    template<typename T>
+    const T * dyn_cast(const Shape * shape){ return shape_cast<T>(shape);}
+    // the caller knows the type: checked in debug builds only
+    template<typename T>
+    T & cast(Shape & shape){
+        assert(isa<T>(shape));
+        return static_cast<T &>(shape);
+    }
+    template<typename T>
+    const T & cast(const Shape & shape){
+        assert(isa<T>(shape));
+        return static_cast<const T &>(shape);
+    }
+#endif
@@ -0,0 +1,80 @@
+#ifndef __SHAPEARENA_H
+#define __SHAPEARENA_H
+    /*
+        Monotonic arena for Shape objects of mixed types, instead of a new & a delete per shape.
+        > create<Circle>(args...) constructs in place at the end of the current block (64 KiB by default,
+          a bigger object gets a block of its own); allocation is a pointer bump
+        > objects never move: the Shape* handed out stay valid until release()
+        > no per-object free. release() (and the destructor) runs the destructors in one pass, newest
+          first, then frees the blocks. Shape's destructor is virtual, so a Shape is never trivially
+          destructible and can't be skipped; the arena only keeps a Shape* per object for that pass
+        > objects created one after the other sit next to each other in memory, whatever their type
+    */
+    #include<algorithm>
+    #include<cstddef>
+    #include<memory>
+    #include<new>
+    #include<type_traits>
+    #include<utility>
+    #include<vector>
+    #include"Shape.h"
+
+    class ShapeArena{
+        struct Block{
+            std::unique_ptr<std::byte[]> memory{};
+            std::size_t size{};
+        };
+        std::size_t m_blockSize{};
+        std::vector<Block> m_blocks{};
+        std::byte * m_next{ nullptr};
+        std::byte * m_end{ nullptr};
+        std::vector<Shape *> m_objects{};// to destroy
+        std::size_t m_used{};
+
+        void * allocate(std::size_t size, std::size_t alignment){
+            std::size_t space{ static_cast<std::size_t>(m_end - m_next)};
+            void * p{ m_next};
+            if(!m_next || !std::align(alignment, size, p, space)){
+                const std::size_t blockSize{ std::max(m_blockSize, size + alignment)};
+                m_blocks.push_back({ std::unique_ptr<std::byte[]>{ new std::byte[blockSize]}, blockSize});
+                m_next = m_blocks.back().memory.get();
+                m_end = m_next + blockSize;
+                space = blockSize;
+                p = m_next;
+                std::align(alignment, size, p, space);
+            }
+            m_next = static_cast<std::byte *>(p) + size;
+            m_used += size;
+            return p;
+        }
+    public:
+        explicit ShapeArena(std::size_t blockSize = 64 * 1024) : m_blockSize{blockSize}{}
+        ShapeArena(const ShapeArena &) = delete;
+        ShapeArena & operator=(const ShapeArena &) = delete;
+        ~ShapeArena(){ release();}
+
+        template<typename T, typename... Args>
+        T * create(Args &&... args){
+            static_assert(std::is_base_of_v<Shape, T>, "ShapeArena holds Shapes");
+            void * p{ allocate(sizeof(T), alignof(T))};
+            T * object{ ::new(p) T(std::forward<Args>(args)...)};
+            m_objects.push_back(object);
+            return object;
+        }
+        void release(){
+            for(auto it{ m_objects.rbegin()}; it != m_objects.rend(); ++it)
+                (*it)->~Shape();
+            m_objects.clear();
+            m_blocks.clear();
+            m_next = m_end = nullptr;
+            m_used = 0;
+        }
+        std::size_t bytesUsed() const { return m_used;}
+        std::size_t bytesReserved() const {
+            std::size_t total{};
+            for(const auto & block : m_blocks)
+                total += block.size;
+            return total + m_objects.capacity() * sizeof(Shape *);
+        }
+    };
+#endif
@@ -0,0 +1,110 @@
+/*
+    ShapeArena (ShapeArena.h) vs a new & a delete per shape, the way main() in
+    VirtualFunctionPractice.cpp does it: allocation, a visiting pass over every shape through Shape*,
+    and teardown. The new/delete side is measured on a fresh heap and on an "aged" one, where
+    other allocations of random sizes came and went between the shapes.
+    No hardware counters here: the iteration time stands in for cache misses.
+
+    build: g++ -std=c++17 -O2 ShapeArenaBench.cpp
+    usage: ShapeArenaBench [shapes] [passes]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<memory>
+#include"ShapeArena.h"
+#include"Random.h"
+
+class CoordinateSumVisitor : public ShapeVisitor{
+public:
+    long long m_sum{};
+    void visit(const Circle & circle) override { m_sum += circle.getCenter().getX() + circle.getRadius();}
+    void visit(const Triangle & triangle) override { m_sum += triangle.getP1().getX() + triangle.getP3().getY();}
+};
+template<typename Func>
+double nsPer(std::size_t count, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(count);
+}
+struct Timings{
+    double allocate{};
+    double visit{};
+    double teardown{};
+    long long sum{};
+};
+// creates the shapes through make(isCircle, radius) and keeps them in order in a vector<Shape*>
+template<typename Make, typename Teardown>
+Timings run(std::size_t count, int passes, std::uint64_t seed, Make && make, Teardown && teardown){
+    Timings t{};
+    std::vector<Shape*> shapes{};
+    shapes.reserve(count);
+    Random rng{ seed};
+    t.allocate = nsPer(count, [&]{
+        for(std::size_t i{}; i < count; ++i){
+            const int radius{ rng.getInt(1, 100)};
+            shapes.push_back(make(radius % 2 == 0, radius));
+        }
+    });
+    t.visit = nsPer(count * static_cast<std::size_t>(passes), [&]{
+        CoordinateSumVisitor visitor{};
+        for(int pass{}; pass < passes; ++pass)
+            for(const Shape * shape : shapes)
+                shape->accept(visitor);
+        t.sum = visitor.m_sum;
+    });
+    t.teardown = nsPer(count, [&]{ teardown(shapes);});
+    return t;
+}
+void print(const char * name, const Timings & t){
+    std::cout<<"  "<<name<<": allocate "<<t.allocate<<", visit "<<t.visit<<", teardown "<<t.teardown<<"\n";
+}
+Shape * makeNew(bool isCircle, int radius){
+    if(isCircle)
+        return new Circle{ Point{ radius, 2, 3}, radius};
+    return new Triangle{ Point{ radius, 2, 3}, Point{ 4, 5, 6}, Point{ 7, 8, radius}};
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int passes{ argc > 2 ? std::stoi(argv[2]) : 10};
+    std::cout<<count<<" shapes, ns per shape\n";
+
+    auto deleteEach{ [](std::vector<Shape*> & shapes){
+        for(auto * ele : shapes)
+            delete ele;
+        shapes.clear();
+    }};
+    Timings fresh{ run(count, passes, 1, makeNew, deleteEach)};
+    print("new/delete, fresh heap", fresh);
+
+    // age the heap: blocks of random size, every other one freed, shapes end up in the holes
+    Timings aged{};
+    {
+        Random rng{ 2};
+        std::vector<std::unique_ptr<char[]>> junk{};
+        std::vector<std::unique_ptr<char[]>> kept{};
+        for(std::size_t i{}; i < count * 2; ++i)
+            junk.emplace_back(new char[static_cast<std::size_t>(rng.getInt(16, 96))]);
+        for(std::size_t i{}; i < junk.size(); i += 2)
+            kept.push_back(std::move(junk[i]));
+        junk.clear();
+        aged = run(count, passes, 1, makeNew, deleteEach);
+    }
+    print("new/delete, aged heap ", aged);
+
+    ShapeArena arena{};
+    Timings arenaTimings{ run(count, passes, 1, [&arena](bool isCircle, int radius) -> Shape *{
+        if(isCircle)
+            return arena.create<Circle>(Point{ radius, 2, 3}, radius);
+        return arena.create<Triangle>(Point{ radius, 2, 3}, Point{ 4, 5, 6}, Point{ 7, 8, radius});
+    }, [&arena](std::vector<Shape*> & shapes){
+        arena.release();
+        shapes.clear();
+    })};
+    print("ShapeArena            ", arenaTimings);
+
+    bool ok{ fresh.sum == arenaTimings.sum && aged.sum == arenaTimings.sum && arena.bytesUsed() == 0};
+    std::cout<<(ok ? "same results\n" : "RESULTS DIFFER\n");
+    return ok ? 0 : 1;
+}
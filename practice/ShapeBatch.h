@@ -0,0 +1,235 @@
+#ifndef __SHAPEBATCH_H
+#define __SHAPEBATCH_H
+    /*
+        area(), perimeter() & boundingBox() for many shapes at once, instead of a virtual call per shape.
+        > the shapes of a ShapeList copied into structure of arrays, one set per type: circles as
+          x, y, z, radius columns, triangles as nine coordinate columns. Each query is then a plain loop
+          per type over __restrict int columns with no branches, which the auto-vectorizer turns into
+          SIMD (build with -O3, -fno-math-errno for the vector sqrt, -march=native for AVX)
+        > results come out in ShapeList order (circles, then triangles), one per shape, and are the
+          values Circle::area() etc. compute: same formulas, same operand order (with -march=native a
+          fused multiply-add may change the last bit)
+        > threadCount splits the shapes into one contiguous chunk per thread; every thread writes its
+          own part of the output, so the result does not depend on the thread count. Batches under
+          minParallelShapes run on the calling thread, a thread start costs more than they do
+        > bounds(): the box around all shapes, per-chunk boxes merged at the end. An empty batch gives
+          the inverted box (min = INT_MAX, max = INT_MIN)
+    */
+    #include<algorithm>
+    #include<cmath>
+    #include<limits>
+    #include<thread>
+    #include<vector>
+    #include"Shape.h"
+    #include"ShapeList.h"
+
+    inline BoundingBox merge(const BoundingBox & a, const BoundingBox & b){
+        return { Point{ std::min(a.min.getX(), b.min.getX()), std::min(a.min.getY(), b.min.getY()), std::min(a.min.getZ(), b.min.getZ())},
+                 Point{ std::max(a.max.getX(), b.max.getX()), std::max(a.max.getY(), b.max.getY()), std::max(a.max.getZ(), b.max.getZ())}};
+    }
+
+    class ShapeBatch{
+        // circles
+        std::vector<int> m_cx{};
+        std::vector<int> m_cy{};
+        std::vector<int> m_cz{};
+        std::vector<int> m_radius{};
+        // triangles, corner 1, 2 & 3
+        std::vector<int> m_x1{}, m_y1{}, m_z1{};
+        std::vector<int> m_x2{}, m_y2{}, m_z2{};
+        std::vector<int> m_x3{}, m_y3{}, m_z3{};
+
+        struct Triangles{
+            const int * __restrict x1; const int * __restrict y1; const int * __restrict z1;
+            const int * __restrict x2; const int * __restrict y2; const int * __restrict z2;
+            const int * __restrict x3; const int * __restrict y3; const int * __restrict z3;
+        };
+        Triangles triangles(std::size_t offset) const {
+            return { m_x1.data() + offset, m_y1.data() + offset, m_z1.data() + offset,
+                     m_x2.data() + offset, m_y2.data() + offset, m_z2.data() + offset,
+                     m_x3.data() + offset, m_y3.data() + offset, m_z3.data() + offset};
+        }
+
+        static void circleAreaKernel(const int * __restrict radius, double * __restrict out, std::size_t n){
+            for(std::size_t i{}; i < n; ++i)
+                out[i] = Circle::pi * radius[i] * radius[i];
+        }
+        static void circlePerimeterKernel(const int * __restrict radius, double * __restrict out, std::size_t n){
+            for(std::size_t i{}; i < n; ++i)
+                out[i] = 2.0 * Circle::pi * radius[i];
+        }
+        static void triangleAreaKernel(const Triangles & t, double * __restrict out, std::size_t n){
+            for(std::size_t i{}; i < n; ++i){
+                const double ux{ static_cast<double>(t.x2[i]) - t.x1[i]};
+                const double uy{ static_cast<double>(t.y2[i]) - t.y1[i]};
+                const double uz{ static_cast<double>(t.z2[i]) - t.z1[i]};
+                const double vx{ static_cast<double>(t.x3[i]) - t.x1[i]};
+                const double vy{ static_cast<double>(t.y3[i]) - t.y1[i]};
+                const double vz{ static_cast<double>(t.z3[i]) - t.z1[i]};
+                const double cx{ uy * vz - uz * vy};
+                const double cy{ uz * vx - ux * vz};
+                const double cz{ ux * vy - uy * vx};
+                out[i] = 0.5 * std::sqrt(cx * cx + cy * cy + cz * cz);
+            }
+        }
+        static double edge(int ax, int ay, int az, int bx, int by, int bz){
+            const double dx{ static_cast<double>(bx) - ax};
+            const double dy{ static_cast<double>(by) - ay};
+            const double dz{ static_cast<double>(bz) - az};
+            return std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+        static void trianglePerimeterKernel(const Triangles & t, double * __restrict out, std::size_t n){
+            for(std::size_t i{}; i < n; ++i)
+                out[i] = edge(t.x1[i], t.y1[i], t.z1[i], t.x2[i], t.y2[i], t.z2[i])
+                       + edge(t.x2[i], t.y2[i], t.z2[i], t.x3[i], t.y3[i], t.z3[i])
+                       + edge(t.x3[i], t.y3[i], t.z3[i], t.x1[i], t.y1[i], t.z1[i]);
+        }
+        static void circleBoxKernel(const int * __restrict x, const int * __restrict y, const int * __restrict z,
+                                    const int * __restrict radius, BoundingBox * out, std::size_t n){
+            for(std::size_t i{}; i < n; ++i)
+                out[i] = { Point{ x[i] - radius[i], y[i] - radius[i], z[i]}, Point{ x[i] + radius[i], y[i] + radius[i], z[i]}};
+        }
+        static void triangleBoxKernel(const Triangles & t, BoundingBox * out, std::size_t n){
+            for(std::size_t i{}; i < n; ++i)
+                out[i] = { Point{ std::min(std::min(t.x1[i], t.x2[i]), t.x3[i]), std::min(std::min(t.y1[i], t.y2[i]), t.y3[i]),
+                                  std::min(std::min(t.z1[i], t.z2[i]), t.z3[i])},
+                           Point{ std::max(std::max(t.x1[i], t.x2[i]), t.x3[i]), std::max(std::max(t.y1[i], t.y2[i]), t.y3[i]),
+                                  std::max(std::max(t.z1[i], t.z2[i]), t.z3[i])}};
+        }
+        static BoundingBox emptyBox(){
+            constexpr int lowest{ std::numeric_limits<int>::min()};
+            constexpr int highest{ std::numeric_limits<int>::max()};
+            return { Point{ highest, highest, highest}, Point{ lowest, lowest, lowest}};
+        }
+        static void extend(const int * __restrict v, std::size_t n, int & low, int & high){
+            int lo{ low};
+            int hi{ high};
+            for(std::size_t i{}; i < n; ++i){
+                lo = std::min(lo, v[i]);
+                hi = std::max(hi, v[i]);
+            }
+            low = lo;
+            high = hi;
+        }
+        // box around shapes [first, last) in ShapeList order
+        BoundingBox boundsOf(std::size_t first, std::size_t last) const {
+            constexpr int lowest{ std::numeric_limits<int>::min()};
+            constexpr int highest{ std::numeric_limits<int>::max()};
+            int lo[3]{ highest, highest, highest};
+            int hi[3]{ lowest, lowest, lowest};
+            const std::size_t circleEnd{ std::min(last, circles())};
+            for(std::size_t i{ first}; i < circleEnd; ++i){
+                lo[0] = std::min(lo[0], m_cx[i] - m_radius[i]);
+                hi[0] = std::max(hi[0], m_cx[i] + m_radius[i]);
+                lo[1] = std::min(lo[1], m_cy[i] - m_radius[i]);
+                hi[1] = std::max(hi[1], m_cy[i] + m_radius[i]);
+                lo[2] = std::min(lo[2], m_cz[i]);
+                hi[2] = std::max(hi[2], m_cz[i]);
+            }
+            if(last > circles()){
+                const std::size_t start{ std::max(first, circles()) - circles()};
+                const std::size_t n{ last - circles() - start};
+                const std::vector<int> * columns[3][3]{ { &m_x1, &m_x2, &m_x3}, { &m_y1, &m_y2, &m_y3}, { &m_z1, &m_z2, &m_z3}};
+                for(int axis{}; axis < 3; ++axis)
+                    for(const std::vector<int> * column : columns[axis])
+                        extend(column->data() + start, n, lo[axis], hi[axis]);
+            }
+            return { Point{ lo[0], lo[1], lo[2]}, Point{ hi[0], hi[1], hi[2]}};
+        }
+        // work(first, last, chunk) over one contiguous chunk of [0, size()) per thread
+        template<typename Func>
+        void inChunks(unsigned int threadCount, Func && work) const {
+            threadCount = std::max(1u, threadCount);
+            if(size() < minParallelShapes)
+                threadCount = 1;
+            const std::size_t chunk{ (size() + threadCount - 1) / threadCount};
+            auto run{ [&](unsigned int t){
+                const std::size_t first{ std::min(size(), t * chunk)};
+                work(first, std::min(size(), first + chunk), t);
+            }};
+            std::vector<std::thread> workers{};
+            for(unsigned int t{1}; t < threadCount; ++t)
+                workers.emplace_back(run, t);
+            run(0);
+            for(auto & worker : workers)
+                worker.join();
+        }
+        // splits shapes [first, last) at the circle/triangle boundary
+        template<typename CircleFunc, typename TriangleFunc>
+        void byType(std::size_t first, std::size_t last, CircleFunc && onCircles, TriangleFunc && onTriangles) const {
+            const std::size_t circleEnd{ std::min(last, circles())};
+            if(first < circleEnd)
+                onCircles(first, circleEnd - first);
+            const std::size_t triangleStart{ std::max(first, circles())};
+            if(triangleStart < last)
+                onTriangles(triangleStart - circles(), last - triangleStart, triangleStart);
+        }
+    public:
+        static constexpr std::size_t minParallelShapes{ 32 * 1024};
+
+        ShapeBatch() = default;
+        explicit ShapeBatch(const ShapeList & shapes){
+            reserve(shapes.getCircles().size(), shapes.getTriangles().size());
+            shapes.visit([this](const auto & shape){ add(shape);});
+        }
+        void reserve(std::size_t circleCount, std::size_t triangleCount){
+            for(auto * column : { &m_cx, &m_cy, &m_cz, &m_radius})
+                column->reserve(circleCount);
+            for(auto * column : { &m_x1, &m_y1, &m_z1, &m_x2, &m_y2, &m_z2, &m_x3, &m_y3, &m_z3})
+                column->reserve(triangleCount);
+        }
+        void add(const Circle & circle){
+            m_cx.push_back(circle.getCenter().getX());
+            m_cy.push_back(circle.getCenter().getY());
+            m_cz.push_back(circle.getCenter().getZ());
+            m_radius.push_back(circle.getRadius());
+        }
+        void add(const Triangle & triangle){
+            const Point * corners[3]{ &triangle.getP1(), &triangle.getP2(), &triangle.getP3()};
+            std::vector<int> * columns[3][3]{ { &m_x1, &m_y1, &m_z1}, { &m_x2, &m_y2, &m_z2}, { &m_x3, &m_y3, &m_z3}};
+            for(int corner{}; corner < 3; ++corner){
+                columns[corner][0]->push_back(corners[corner]->getX());
+                columns[corner][1]->push_back(corners[corner]->getY());
+                columns[corner][2]->push_back(corners[corner]->getZ());
+            }
+        }
+        std::size_t circles() const { return m_radius.size();}
+        std::size_t triangles() const { return m_x1.size();}
+        std::size_t size() const { return circles() + triangles();}
+
+        // out must hold size() values
+        void areas(double * out, unsigned int threadCount = 1) const {
+            inChunks(threadCount, [&](std::size_t first, std::size_t last, unsigned int){
+                byType(first, last,
+                    [&](std::size_t start, std::size_t n){ circleAreaKernel(m_radius.data() + start, out + start, n);},
+                    [&](std::size_t start, std::size_t n, std::size_t at){ triangleAreaKernel(triangles(start), out + at, n);});
+            });
+        }
+        void perimeters(double * out, unsigned int threadCount = 1) const {
+            inChunks(threadCount, [&](std::size_t first, std::size_t last, unsigned int){
+                byType(first, last,
+                    [&](std::size_t start, std::size_t n){ circlePerimeterKernel(m_radius.data() + start, out + start, n);},
+                    [&](std::size_t start, std::size_t n, std::size_t at){ trianglePerimeterKernel(triangles(start), out + at, n);});
+            });
+        }
+        void boundingBoxes(BoundingBox * out, unsigned int threadCount = 1) const {
+            inChunks(threadCount, [&](std::size_t first, std::size_t last, unsigned int){
+                byType(first, last,
+                    [&](std::size_t start, std::size_t n){
+                        circleBoxKernel(m_cx.data() + start, m_cy.data() + start, m_cz.data() + start, m_radius.data() + start, out + start, n);
+                    },
+                    [&](std::size_t start, std::size_t n, std::size_t at){ triangleBoxKernel(triangles(start), out + at, n);});
+            });
+        }
+        BoundingBox bounds(unsigned int threadCount = 1) const {
+            std::vector<BoundingBox> partial(std::max(1u, threadCount), emptyBox());
+            inChunks(threadCount, [&](std::size_t first, std::size_t last, unsigned int t){
+                partial[t] = boundsOf(first, last);
+            });
+            BoundingBox total{ emptyBox()};
+            for(const auto & box : partial)
+                total = merge(total, box);
+            return total;
+        }
+    };
+#endif
@@ -0,0 +1,112 @@
+/*
+    ShapeBatch (ShapeBatch.h) vs a virtual area() / perimeter() / boundingBox() call per shape over a
+    std::vector<Shape*> (shapes new'd in random type order): shapes/sec per query, with the batch run on
+    1 thread and on several. Results are checked against the per-object (scalar) Shape members.
+
+    build: g++ -std=c++17 -O3 -march=native -fno-math-errno -pthread ShapeBatchBench.cpp
+    usage: ShapeBatchBench [shapes] [threads] [repeats]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<cmath>
+#include<memory>
+#include<thread>
+#include"ShapeBatch.h"
+#include"Random.h"
+
+template<typename Func>
+double shapesPerSec(std::size_t shapes, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+    return shapes / elapsed.count();
+}
+bool sameBox(const BoundingBox & a, const BoundingBox & b){
+    return a.min.getX() == b.min.getX() && a.min.getY() == b.min.getY() && a.min.getZ() == b.min.getZ()
+        && a.max.getX() == b.max.getX() && a.max.getY() == b.max.getY() && a.max.getZ() == b.max.getZ();
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 2'000'000};
+    unsigned int threads{ argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : std::max(2u, std::thread::hardware_concurrency())};
+    int repeats{ argc > 3 ? std::stoi(argv[3]) : 5};
+
+    Random rng{ 11};
+    auto coordinate{ [&rng]{ return rng.getInt(-10000, 10000);}};
+    std::vector<std::unique_ptr<Shape>> owned{};
+    std::vector<Shape*> pointers{};
+    ShapeList list{};
+    for(std::size_t i{}; i < count; ++i){
+        if(rng.getInt(0, 1)){
+            Circle circle{ Point{ coordinate(), coordinate(), coordinate()}, rng.getInt(1, 500)};
+            list.add(circle);
+            owned.push_back(std::make_unique<Circle>(circle));
+        }else{
+            Triangle triangle{ Point{ coordinate(), coordinate(), coordinate()}, Point{ coordinate(), coordinate(), coordinate()},
+                               Point{ coordinate(), coordinate(), coordinate()}};
+            list.add(triangle);
+            owned.push_back(std::make_unique<Triangle>(triangle));
+        }
+        pointers.push_back(owned.back().get());
+    }
+    const ShapeBatch batch{ list};
+
+    // validation: batch (1 thread and threads) against the scalar members, in ShapeList order
+    std::vector<double> area(count), perimeter(count), areaN(count), perimeterN(count);
+    std::vector<BoundingBox> box(count), boxN(count);
+    batch.areas(area.data());
+    batch.perimeters(perimeter.data());
+    batch.boundingBoxes(box.data());
+    batch.areas(areaN.data(), threads);
+    batch.perimeters(perimeterN.data(), threads);
+    batch.boundingBoxes(boxN.data(), threads);
+    bool ok{ area == areaN && perimeter == perimeterN};
+    double worst{};
+    BoundingBox all{ list.getCircles().empty() ? list.getTriangles().front().boundingBox() : list.getCircles().front().boundingBox()};
+    std::size_t i{};
+    list.visit([&](const auto & shape){
+        worst = std::max(worst, std::fabs(area[i] - shape.area()) / std::max(shape.area(), 1e-300));
+        worst = std::max(worst, std::fabs(perimeter[i] - shape.perimeter()) / std::max(shape.perimeter(), 1e-300));
+        ok = ok && sameBox(box[i], shape.boundingBox()) && sameBox(boxN[i], box[i]);
+        all = merge(all, shape.boundingBox());
+        ++i;
+    });
+    ok = ok && worst <= 4.5e-16 && sameBox(batch.bounds(), all) && sameBox(batch.bounds(threads), all);
+    std::cout<<count<<" shapes ("<<batch.circles()<<" circles), max relative difference from the scalar members "<<worst<<"\n";
+
+    double sink{};
+    const std::size_t total{ count * static_cast<std::size_t>(repeats)};
+    auto report{ [&](const char * name, auto && virtualCall, auto && batchCall){
+        std::cout<<name<<" (M shapes/sec)\n  virtual call per shape: "<<shapesPerSec(total, [&]{
+            for(int r{}; r < repeats; ++r)
+                virtualCall();
+        }) / 1e6;
+        std::cout<<"\n  ShapeBatch, 1 thread  : "<<shapesPerSec(total, [&]{
+            for(int r{}; r < repeats; ++r)
+                batchCall(1u);
+        }) / 1e6;
+        std::cout<<"\n  ShapeBatch, "<<threads<<" threads : "<<shapesPerSec(total, [&]{
+            for(int r{}; r < repeats; ++r)
+                batchCall(threads);
+        }) / 1e6<<"\n";
+    }};
+    report("area",
+        [&]{ for(std::size_t j{}; j < count; ++j) area[j] = pointers[j]->area(); sink += area[0];},
+        [&](unsigned int t){ batch.areas(area.data(), t); sink += area[0];});
+    report("perimeter",
+        [&]{ for(std::size_t j{}; j < count; ++j) perimeter[j] = pointers[j]->perimeter(); sink += perimeter[0];},
+        [&](unsigned int t){ batch.perimeters(perimeter.data(), t); sink += perimeter[0];});
+    report("boundingBox",
+        [&]{ for(std::size_t j{}; j < count; ++j) box[j] = pointers[j]->boundingBox(); sink += box[0].min.getX();},
+        [&](unsigned int t){ batch.boundingBoxes(box.data(), t); sink += box[0].min.getX();});
+    report("bounds (one box around all)",
+        [&]{
+            BoundingBox b{ pointers[0]->boundingBox()};
+            for(std::size_t j{}; j < count; ++j)
+                b = merge(b, pointers[j]->boundingBox());
+            sink += b.max.getX();
+        },
+        [&](unsigned int t){ sink += batch.bounds(t).max.getX();});
+    std::cout<<(ok ? "results match the scalar members\n" : "MISMATCH\n")<<(sink == 0.5 ? " " : "");
+    return ok ? 0 : 1;
+}
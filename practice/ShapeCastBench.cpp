@@ -0,0 +1,83 @@
+/*
+    Kind tag queries (isa / shape_cast in Shape.h) vs dynamic_cast on a std::vector<Shape*>.
+    > hot: 1024 shapes walked over and over, everything in L1, so the time is the cast itself
+    > getLargestRadius over 1e6 shapes, as in VirtualFunctionPractice.cpp
+    Also builds with -fno-rtti: the dynamic_cast rows are then left out.
+
+    build: g++ -std=c++17 -O2 ShapeCastBench.cpp
+           g++ -std=c++17 -O2 -fno-rtti ShapeCastBench.cpp
+    usage: ShapeCastBench [shapes] [passes]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include"Shape.h"
+#include"Random.h"
+
+template<typename Cast>
+int largestRadius(const std::vector<Shape*> & v, Cast && cast){
+    int max{};
+    for(Shape * ele : v){
+        const Circle * pCircle{ cast(ele)};
+        if(pCircle && pCircle->getRadius() > max)
+            max = pCircle->getRadius();
+    }
+    return max;
+}
+template<typename Cast>
+double nsPerCast(const std::vector<Shape*> & v, int passes, int & result, Cast && cast){
+    auto start{ std::chrono::steady_clock::now()};
+    int max{};
+    for(int pass{}; pass < passes; ++pass)
+        max += largestRadius(v, cast);
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    result = max / passes;
+    return elapsed.count() / (static_cast<double>(v.size()) * passes);
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int passes{ argc > 2 ? std::stoi(argv[2]) : 10};
+
+    Random rng{ 43};
+    std::vector<Shape*> shapes{};
+    for(std::size_t i{}; i < count; ++i){
+        Point a{ rng.getInt(-100, 100), rng.getInt(-100, 100), rng.getInt(-100, 100)};
+        if(rng.getInt(0, 1))
+            shapes.push_back(new Circle{ a, rng.getInt(1, 1000)});
+        else
+            shapes.push_back(new Triangle{ a, a, a});
+    }
+    std::vector<Shape*> hot(shapes.begin(), shapes.begin() + static_cast<std::ptrdiff_t>(std::min<std::size_t>(1024, count)));
+    const int hotPasses{ static_cast<int>(passes * (count / hot.size()))};
+
+    auto tagCast{ [](Shape * shape){ return shape_cast<Circle>(shape);}};
+    int tagHot{}, tagAll{};
+    double tagHotNs{ nsPerCast(hot, hotPasses, tagHot, tagCast)};
+    double tagAllNs{ nsPerCast(shapes, passes, tagAll, tagCast)};
+    bool ok{ true};
+    std::cout<<"ns per shape: hot (1024 shapes) / getLargestRadius over "<<count<<"\n";
+#ifdef __GXX_RTTI
+    auto rttiCast{ [](Shape * shape){ return dynamic_cast<Circle *>(shape);}};
+    int rttiHot{}, rttiAll{};
+    double rttiHotNs{ nsPerCast(hot, hotPasses, rttiHot, rttiCast)};
+    double rttiAllNs{ nsPerCast(shapes, passes, rttiAll, rttiCast)};
+    std::cout<<"  dynamic_cast    : "<<rttiHotNs<<" / "<<rttiAllNs<<"\n";
+    ok = rttiHot == tagHot && rttiAll == tagAll;
+#else
+    std::cout<<"  dynamic_cast    : not available (-fno-rtti)\n";
+#endif
+    std::cout<<"  shape_cast (tag): "<<tagHotNs<<" / "<<tagAllNs<<"\n";
+
+    // the queries themselves
+    Circle circle{ Point{}, 1};
+    Triangle triangle{ Point{}, Point{}, Point{}};
+    Shape * asShape{ &circle};
+    const Shape * constShape{ &triangle};
+    ok = ok && isa<Circle>(circle) && !isa<Triangle>(asShape) && isa<Triangle>(constShape)
+        && shape_cast<Circle>(asShape) == &circle && !dyn_cast<Circle>(constShape)
+        && &cast<Triangle>(*constShape) == &triangle && !isa<Circle>(static_cast<Shape *>(nullptr));
+    for(auto * shape : shapes)
+        delete shape;
+    std::cout<<(ok ? "same results\n" : "RESULTS DIFFER\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+#ifndef __SHAPEFORMAT_H
+#define __SHAPEFORMAT_H
+    /*
+        Shape export without iostream: text through std::to_chars into a CharBuffer, plus a binary dump
+        of a ShapeList and its loader.
+        > format(buffer, shape) writes exactly what Circle::print / Triangle::print / Point's operator<<
+          write to a stream in its default state (decimal, no showpos, no width). std::to_chars has no
+          locale, no sentry and no virtual call per number
+        > each shape reserves room for its longest possible text once, then writes with raw pointer
+          stores; the buffer grows by doubling, flush() empties it into a FILE* for exports larger
+          than memory should hold
+        > binary format (host byte order): "SHPB", u32 version, u64 circle count, then per circle
+          i32 x, y, z, radius, u64 triangle count, then per triangle i32 x, y, z of p1, p2 & p3.
+          Shapes come back in ShapeList order (circles, then triangles)
+        > loadBinary() returns the number of shapes or a ShapeLoadError with the byte offset of the
+          first section that is truncated (0: not a shape dump)
+    */
+    #include<algorithm>
+    #include<charconv>
+    #include<cstdint>
+    #include<cstdio>
+    #include<cstring>
+    #include<memory>
+    #include<string_view>
+    #include"Expected.h"
+    #include"Shape.h"
+    #include"ShapeList.h"
+
+    class CharBuffer{
+        std::unique_ptr<char[]> m_data{};
+        std::size_t m_size{};
+        std::size_t m_capacity{};
+    public:
+        void reserve(std::size_t capacity){
+            if(capacity <= m_capacity)
+                return;
+            std::unique_ptr<char[]> data{ new char[capacity]};
+            if(m_size)
+                std::memcpy(data.get(), m_data.get(), m_size);
+            m_data = std::move(data);
+            m_capacity = capacity;
+        }
+        // room for at least n more chars at the returned position; finish with commit(end of what was written)
+        char * prepare(std::size_t n){
+            if(m_capacity - m_size < n)
+                reserve(std::max(m_size + n, m_capacity * 2));
+            return m_data.get() + m_size;
+        }
+        void commit(const char * end){ m_size = static_cast<std::size_t>(end - m_data.get());}
+        void append(const void * bytes, std::size_t n){
+            char * p{ prepare(n)};
+            std::memcpy(p, bytes, n);
+            commit(p + n);
+        }
+        void append(std::string_view text){ append(text.data(), text.size());}
+        void clear(){ m_size = 0;}
+        const char * data() const { return m_data.get();}
+        std::size_t size() const { return m_size;}
+        std::string_view view() const { return { m_data.get(), m_size};}
+        // writes the contents and empties the buffer
+        bool flush(std::FILE * file){
+            const bool ok{ std::fwrite(m_data.get(), 1, m_size, file) == m_size};
+            m_size = 0;
+            return ok;
+        }
+    };
+
+    class ShapeText{
+        template<std::size_t N>
+        static char * put(char * p, const char (&literal)[N]){
+            std::memcpy(p, literal, N - 1);
+            return p + N - 1;
+        }
+        static char * put(char * p, int value){ return std::to_chars(p, p + 11, value).ptr;}
+        static char * put(char * p, const Point & point){
+            p = put(p, "Point (");
+            p = put(p, point.getX());
+            p = put(p, ", ");
+            p = put(p, point.getY());
+            p = put(p, ", ");
+            p = put(p, point.getZ());
+            return put(p, ") ");
+        }
+    public:
+        static constexpr std::size_t maxPoint{ 7 + 3 * 11 + 2 * 2 + 2};
+        static constexpr std::size_t maxCircle{ 9 + maxPoint + 9 + 11 + 1};
+        static constexpr std::size_t maxTriangle{ 11 + 3 * maxPoint + 2 * 2 + 3};
+
+        static void format(CharBuffer & out, const Point & point){
+            out.commit(put(out.prepare(maxPoint), point));
+        }
+        static void format(CharBuffer & out, const Circle & circle){
+            char * p{ out.prepare(maxCircle)};
+            p = put(p, "Circle ( ");
+            p = put(p, circle.getCenter());
+            p = put(p, ", radius ");
+            p = put(p, circle.getRadius());
+            out.commit(put(p, "\n"));
+        }
+        static void format(CharBuffer & out, const Triangle & triangle){
+            char * p{ out.prepare(maxTriangle)};
+            p = put(p, "Triangle ( ");
+            p = put(p, triangle.getP1());
+            p = put(p, ", ");
+            p = put(p, triangle.getP2());
+            p = put(p, ", ");
+            p = put(p, triangle.getP3());
+            out.commit(put(p, " )\n"));
+        }
+    };
+
+    inline void format(CharBuffer & out, const Point & point){ ShapeText::format(out, point);}
+    inline void format(CharBuffer & out, const Circle & circle){ ShapeText::format(out, circle);}
+    inline void format(CharBuffer & out, const Triangle & triangle){ ShapeText::format(out, triangle);}
+    inline void format(CharBuffer & out, const Shape & shape){
+        switch(shape.getKind()){
+            case Shape::Kind::circle:   format(out, cast<Circle>(shape)); break;
+            case Shape::Kind::triangle: format(out, cast<Triangle>(shape)); break;
+        }
+    }
+    // same text as operator<<(std::ostream&, const ShapeList&)
+    inline void format(CharBuffer & out, const ShapeList & shapes){
+        shapes.visit([&out](const auto & shape){ format(out, shape);});
+    }
+
+    struct ShapeLoadError{
+        std::size_t offset{};
+    };
+    constexpr char shapeDumpMagic[4]{ 'S', 'H', 'P', 'B'};
+    constexpr std::uint32_t shapeDumpVersion{ 1};
+
+    inline void dumpBinary(CharBuffer & out, const ShapeList & shapes){
+        const std::uint64_t circles{ shapes.getCircles().size()};
+        const std::uint64_t triangles{ shapes.getTriangles().size()};
+        out.prepare(sizeof(shapeDumpMagic) + 4 + 16 + circles * 16 + triangles * 36);
+        out.append(shapeDumpMagic, sizeof(shapeDumpMagic));
+        out.append(&shapeDumpVersion, sizeof(shapeDumpVersion));
+        out.append(&circles, sizeof(circles));
+        char * p{ out.prepare(circles * 16)};
+        for(const Circle & circle : shapes.getCircles()){
+            const std::int32_t fields[4]{ circle.getCenter().getX(), circle.getCenter().getY(), circle.getCenter().getZ(), circle.getRadius()};
+            std::memcpy(p, fields, sizeof(fields));
+            p += sizeof(fields);
+        }
+        out.commit(p);
+        out.append(&triangles, sizeof(triangles));
+        p = out.prepare(triangles * 36);
+        for(const Triangle & triangle : shapes.getTriangles()){
+            const std::int32_t fields[9]{ triangle.getP1().getX(), triangle.getP1().getY(), triangle.getP1().getZ(),
+                                          triangle.getP2().getX(), triangle.getP2().getY(), triangle.getP2().getZ(),
+                                          triangle.getP3().getX(), triangle.getP3().getY(), triangle.getP3().getZ()};
+            std::memcpy(p, fields, sizeof(fields));
+            p += sizeof(fields);
+        }
+        out.commit(p);
+    }
+    // adds the shapes of the dump in [first, last) to `shapes`
+    inline Expected<std::size_t, ShapeLoadError> loadBinary(const char * first, const char * last, ShapeList & shapes){
+        const char * p{ first};
+        auto offset{ [&]{ return static_cast<std::size_t>(p - first);}};
+        auto left{ [&]{ return static_cast<std::size_t>(last - p);}};
+        std::uint32_t version{};
+        if(left() < sizeof(shapeDumpMagic) + sizeof(version) || std::memcmp(p, shapeDumpMagic, sizeof(shapeDumpMagic)) != 0)
+            return unexpected(ShapeLoadError{ 0});
+        std::memcpy(&version, p + sizeof(shapeDumpMagic), sizeof(version));
+        if(version != shapeDumpVersion)
+            return unexpected(ShapeLoadError{ 0});
+        p += sizeof(shapeDumpMagic) + sizeof(version);
+
+        std::uint64_t circles{};
+        if(left() < sizeof(circles))
+            return unexpected(ShapeLoadError{ offset()});
+        std::memcpy(&circles, p, sizeof(circles));
+        if((left() - sizeof(circles)) / 16 < circles)
+            return unexpected(ShapeLoadError{ offset()});
+        p += sizeof(circles);
+        const char * circleData{ p};
+        p += circles * 16;
+
+        std::uint64_t triangles{};
+        if(left() < sizeof(triangles))
+            return unexpected(ShapeLoadError{ offset()});
+        std::memcpy(&triangles, p, sizeof(triangles));
+        if((left() - sizeof(triangles)) / 36 < triangles)
+            return unexpected(ShapeLoadError{ offset()});
+        p += sizeof(triangles);
+
+        shapes.reserve(shapes.getCircles().size() + circles, shapes.getTriangles().size() + triangles);
+        for(std::uint64_t i{}; i < circles; ++i, circleData += 16){
+            std::int32_t f[4];
+            std::memcpy(f, circleData, sizeof(f));
+            shapes.add(Circle{ Point{ f[0], f[1], f[2]}, f[3]});
+        }
+        for(std::uint64_t i{}; i < triangles; ++i, p += 36){
+            std::int32_t f[9];
+            std::memcpy(f, p, sizeof(f));
+            shapes.add(Triangle{ Point{ f[0], f[1], f[2]}, Point{ f[3], f[4], f[5]}, Point{ f[6], f[7], f[8]}});
+        }
+        return static_cast<std::size_t>(circles + triangles);
+    }
+#endif
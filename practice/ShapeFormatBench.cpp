@@ -0,0 +1,94 @@
+/*
+    ShapeFormat (ShapeFormat.h) vs the iostream printing of VirtualFunctionPractice.cpp: MB/s of text
+    written by operator<< into a std::ostringstream and by format() into a CharBuffer (the two must be
+    the same bytes), then MB/s of the binary dump and of loading it back.
+
+    build: g++ -std=c++17 -O2 ShapeFormatBench.cpp
+    usage: ShapeFormatBench [shapes] [repeats]
+*/
+#include<iostream>
+#include<sstream>
+#include<chrono>
+#include<climits>
+#include"ShapeFormat.h"
+#include"Random.h"
+
+template<typename Func>
+double seconds(Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count();
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int repeats{ argc > 2 ? std::stoi(argv[2]) : 3};
+
+    // mostly everyday coordinates, some at the ends of the int range
+    Random rng{ 5};
+    auto coordinate{ [&rng]{
+        switch(rng.getInt(0, 15)){
+            case 0:  return INT_MIN;
+            case 1:  return INT_MAX;
+            case 2:  return 0;
+            default: return rng.getInt(-100000, 100000);
+        }
+    }};
+    ShapeList shapes{};
+    for(std::size_t i{}; i < count; ++i){
+        if(rng.getInt(0, 1))
+            shapes.add(Circle{ Point{ coordinate(), coordinate(), coordinate()}, coordinate()});
+        else
+            shapes.add(Triangle{ Point{ coordinate(), coordinate(), coordinate()}, Point{ coordinate(), coordinate(), coordinate()},
+                                 Point{ coordinate(), coordinate(), coordinate()}});
+    }
+
+    std::string streamed{};
+    CharBuffer text{};
+    double streamTime{ 1e300}, bufferTime{ 1e300};
+    for(int r{}; r < repeats; ++r){
+        streamTime = std::min(streamTime, seconds([&]{
+            std::ostringstream out{};
+            out<<shapes;
+            streamed = out.str();
+        }));
+        bufferTime = std::min(bufferTime, seconds([&]{
+            text.clear();
+            format(text, shapes);
+        }));
+    }
+    bool ok{ text.view() == streamed};
+    const double textMB{ static_cast<double>(text.size()) / 1e6};
+    std::cout<<count<<" shapes, "<<textMB<<" MB of text, best of "<<repeats<<"\n"
+             <<"  operator<< into ostringstream: "<<textMB / streamTime<<" MB/s\n"
+             <<"  format() into CharBuffer     : "<<textMB / bufferTime<<" MB/s\n";
+
+    CharBuffer binary{};
+    ShapeList loaded{};
+    double dumpTime{ 1e300}, loadTime{ 1e300};
+    for(int r{}; r < repeats; ++r){
+        dumpTime = std::min(dumpTime, seconds([&]{
+            binary.clear();
+            dumpBinary(binary, shapes);
+        }));
+        loadTime = std::min(loadTime, seconds([&]{
+            loaded = ShapeList{};
+            auto result{ loadBinary(binary.data(), binary.data() + binary.size(), loaded)};
+            ok = ok && result && *result == count;
+        }));
+    }
+    CharBuffer reloaded{};
+    format(reloaded, loaded);
+    ok = ok && reloaded.view() == text.view();
+    // every truncation is reported, never read past the end
+    for(std::size_t cut : { std::size_t{0}, std::size_t{3}, std::size_t{9}, std::size_t{17}, binary.size() / 2, binary.size() - 1}){
+        ShapeList partial{};
+        ok = ok && !loadBinary(binary.data(), binary.data() + cut, partial);
+    }
+    const double binaryMB{ static_cast<double>(binary.size()) / 1e6};
+    std::cout<<binaryMB<<" MB binary\n"
+             <<"  dumpBinary: "<<binaryMB / dumpTime<<" MB/s\n"
+             <<"  loadBinary: "<<binaryMB / loadTime<<" MB/s\n";
+    std::cout<<(ok ? "text identical to operator<<, binary round trip identical\n" : "MISMATCH\n");
+    return ok ? 0 : 1;
+}
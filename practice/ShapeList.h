@@ -0,0 +1,51 @@
+#ifndef __SHAPELIST_H
+#define __SHAPELIST_H
+    /*
+        Shapes without std::vector<Shape*>: one contiguous pool per concrete type.
+        > no new per shape, no pointer chase: circles sit back to back in a std::vector<Circle>,
+          triangles in a std::vector<Triangle>
+        > visit(func) calls func(const Circle&) over the circles, then func(const Triangle&) over the
+          triangles: the type is known statically, no virtual call and no RTTI (Circle & Triangle are
+          final, so even their virtual members are called directly)
+        > getLargestRadius() only walks the circles, no dynamic_cast per shape
+        > order is by type, then by insertion within a type; Shape* handed out stay valid only until
+          the next add of the same type (pools are vectors)
+    */
+    #include<algorithm>
+    #include<iostream>
+    #include<vector>
+    #include"Shape.h"
+
+    class ShapeList{
+        std::vector<Circle> m_circles{};
+        std::vector<Triangle> m_triangles{};
+    public:
+        void add(const Circle & circle){ m_circles.push_back(circle);}
+        void add(const Triangle & triangle){ m_triangles.push_back(triangle);}
+        void reserve(std::size_t circles, std::size_t triangles){
+            m_circles.reserve(circles);
+            m_triangles.reserve(triangles);
+        }
+        std::size_t size() const { return m_circles.size() + m_triangles.size();}
+        const std::vector<Circle> & getCircles() const { return m_circles;}
+        const std::vector<Triangle> & getTriangles() const { return m_triangles;}
+
+        template<typename Func>
+        void visit(Func && func) const {
+            for(const Circle & circle : m_circles)
+                func(circle);
+            for(const Triangle & triangle : m_triangles)
+                func(triangle);
+        }
+        friend std::ostream & operator<<(std::ostream & out, const ShapeList & shapes){
+            shapes.visit([&out](const auto & shape){ shape.print(out);});
+            return out;
+        }
+    };
+    inline int getLargestRadius(const ShapeList & shapes){
+        int max{};
+        for(const Circle & circle : shapes.getCircles())
+            max = std::max(max, circle.getRadius());
+        return max;
+    }
+#endif
@@ -0,0 +1,99 @@
+/*
+    ShapeList (per-type pools, ShapeList.h) vs std::vector<Shape*> of new-ed shapes at 1e6 shapes:
+    a full pass over every shape (ShapeVisitor, one virtual accept() per shape vs static visit())
+    and getLargestRadius (dynamic_cast per shape vs walking the circles).
+    The pointer version is measured in allocation order and shuffled, as a long lived heap ends up.
+
+    build: g++ -std=c++17 -O2 ShapeListBench.cpp
+    usage: ShapeListBench [shapes] [passes]
+*/
+#include<iostream>
+#include<vector>
+#include<chrono>
+#include<algorithm>
+#include"ShapeList.h"
+#include"Random.h"
+
+// the original
+int getLargestRadius(const std :: vector<Shape *> &v ){
+    int max{};
+    const Circle *pCircle{nullptr};
+    for(auto & ele : v){
+        pCircle = dynamic_cast<const Circle *>(ele);
+        if(pCircle && pCircle->getRadius() > max)
+           max = pCircle->getRadius();
+    }
+    return max;
+}
+// the work done per shape in the iteration test: sum of all coordinates
+struct CoordinateSum{
+    long long sum{};
+    void operator()(const Point & p){ sum += p.getX() + p.getY() + p.getZ();}
+    void operator()(const Circle & circle){ (*this)(circle.getCenter()); sum += circle.getRadius();}
+    void operator()(const Triangle & triangle){ (*this)(triangle.getP1()); (*this)(triangle.getP2()); (*this)(triangle.getP3());}
+};
+class CoordinateSumVisitor : public ShapeVisitor{
+public:
+    CoordinateSum m_sum{};
+    void visit(const Circle & circle) override { m_sum(circle);}
+    void visit(const Triangle & triangle) override { m_sum(triangle);}
+};
+template<typename Func>
+double nsPerShape(std::size_t shapes, int passes, Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    for(int pass{}; pass < passes; ++pass)
+        func();
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count() / (static_cast<double>(shapes) * passes);
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 1'000'000};
+    int passes{ argc > 2 ? std::stoi(argv[2]) : 10};
+
+    Random rng{ 42};
+    std::vector<Shape*> pointers{};
+    ShapeList list{};
+    for(std::size_t i{}; i < count; ++i){
+        Point a{ rng.getInt(-100, 100), rng.getInt(-100, 100), rng.getInt(-100, 100)};
+        if(rng.getInt(0, 1)){
+            Circle circle{ a, rng.getInt(1, 1000)};
+            pointers.push_back(new Circle{ circle});
+            list.add(circle);
+        }else{
+            Triangle triangle{ a, Point{ a.getX() + 1, a.getY(), a.getZ()}, Point{ a.getX(), a.getY() + 1, a.getZ()}};
+            pointers.push_back(new Triangle{ triangle});
+            list.add(triangle);
+        }
+    }
+    std::vector<Shape*> shuffled{ pointers};
+    for(std::size_t i{ shuffled.size()}; i > 1; --i)
+        std::swap(shuffled[i - 1], shuffled[static_cast<std::size_t>(rng.next() % i)]);
+
+    long long pointerSum{}, listSum{};
+    int pointerRadius{}, listRadius{};
+    std::cout<<count<<" shapes, ns per shape\n";
+    for(const auto * v : { &pointers, &shuffled }){
+        double visitNs{ nsPerShape(count, passes, [&]{
+            CoordinateSumVisitor visitor{};
+            for(const Shape * shape : *v)
+                shape->accept(visitor);
+            pointerSum = visitor.m_sum.sum;
+        })};
+        double radiusNs{ nsPerShape(count, passes, [&]{ pointerRadius = getLargestRadius(*v);})};
+        std::cout<<"  vector<Shape*> "<<(v == &pointers ? "in allocation order" : "shuffled           ")
+                 <<": visit "<<visitNs<<", getLargestRadius "<<radiusNs<<"\n";
+    }
+    double visitNs{ nsPerShape(count, passes, [&]{
+        CoordinateSum sum{};
+        list.visit(sum);
+        listSum = sum.sum;
+    })};
+    double radiusNs{ nsPerShape(count, passes, [&]{ listRadius = getLargestRadius(list);})};
+    std::cout<<"  ShapeList                         : visit "<<visitNs<<", getLargestRadius "<<radiusNs<<"\n";
+
+    for(auto * shape : pointers)
+        delete shape;
+    bool ok{ pointerSum == listSum && pointerRadius == listRadius};
+    std::cout<<(ok ? "same results\n" : "RESULTS DIFFER\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,259 @@
+#ifndef __SHAREDPOINTER_H
+#define __SHAREDPOINTER_H
+    /*
+        SharedPointer / WeakPointer: the SharedPointer sketch of notes/Move semantics and smart pointers/shared_ptr.cpp
+        finished, along the lines of std::shared_ptr / std::weak_ptr.
+        > control block: strong count (SharedPointers) and weak count (WeakPointers, plus one held by all
+          the SharedPointers together), packed into one std::atomic<std::uint64_t> (strong in the low
+          32 bits, weak in the high 32), so copies may be made and dropped from any thread.
+          A copy is a relaxed fetch_add; a release is an acq_rel fetch_sub, the one that reaches zero
+          destroys the object (strong) or frees the block (weak)
+        > the last SharedPointer with no WeakPointer left skips both decrements: one acquire load sees
+          both counts at once, strong == 1 && weak == 1 means no other thread holds a reference it could
+          copy or lock() from. Two separate loads could miss a lock() + weak release in between
+        > makeShared<T>(args...): one allocation for block and object. The block has raw storage for a T
+          and constructs it there with placement new; the object is destroyed when the strong count
+          reaches zero, its storage goes with the block when the weak count does
+        > SharedPointer<T>{ new T}: the object comes in already allocated, the block is a second
+          allocation that keeps the pointer and a deleter (delete by default)
+        > aliasing: SharedPointer<int>{ pairPointer, &pairPointer->first} shares ownership of the whole
+          pair but points at a member; get() returns the stored pointer, the block deletes what it owns
+        > WeakPointer::lock(): a SharedPointer if the object is still alive (compare-exchange on the strong
+          count, never resurrects a zero count), else an empty one
+        > one block type per T (per T & deleter), with a virtual call only on destroy & free
+    */
+    #include<atomic>
+    #include<cstddef>
+    #include<cstdint>
+    #include<memory>
+    #include<new>
+    #include<type_traits>
+    #include<utility>
+
+    class SharedControlBlock{
+        static constexpr std::uint64_t strongOne{ 1};
+        static constexpr std::uint64_t weakOne{ std::uint64_t{ 1} << 32};
+        static constexpr std::uint64_t strongMask{ weakOne - 1};
+        // strong count in the low half, weak count (WeakPointers + 1 while strong > 0) in the high half
+        std::atomic<std::uint64_t> m_counts{ weakOne + strongOne};
+
+        virtual void destroyObject() noexcept = 0;
+        virtual void destroyBlock() noexcept = 0;
+    protected:
+        SharedControlBlock() = default;
+        virtual ~SharedControlBlock() = default;
+    public:
+        SharedControlBlock(const SharedControlBlock &) = delete;
+        SharedControlBlock & operator=(const SharedControlBlock &) = delete;
+
+        void addStrong() noexcept { m_counts.fetch_add(strongOne, std::memory_order_relaxed);}
+        void addWeak() noexcept { m_counts.fetch_add(weakOne, std::memory_order_relaxed);}
+        void releaseStrong() noexcept {
+            // last SharedPointer and no WeakPointer, both read in one load: no one else can reach the block
+            if(m_counts.load(std::memory_order_acquire) == weakOne + strongOne){
+                destroyObject();
+                destroyBlock();
+                return;
+            }
+            if((m_counts.fetch_sub(strongOne, std::memory_order_acq_rel) & strongMask) == 1){
+                destroyObject();
+                releaseWeak();
+            }
+        }
+        void releaseWeak() noexcept {
+            if((m_counts.fetch_sub(weakOne, std::memory_order_acq_rel) >> 32) == 1)
+                destroyBlock();
+        }
+        // for lock(): a new strong reference unless the object is already gone
+        bool tryAddStrong() noexcept {
+            std::uint64_t counts{ m_counts.load(std::memory_order_relaxed)};
+            while((counts & strongMask) != 0)
+                if(m_counts.compare_exchange_weak(counts, counts + strongOne, std::memory_order_acq_rel, std::memory_order_relaxed))
+                    return true;
+            return false;
+        }
+        long useCount() const noexcept { return static_cast<long>(m_counts.load(std::memory_order_relaxed) & strongMask);}
+    };
+
+    // makeShared: the object lives inside the block
+    template<typename T>
+    class InplaceControlBlock final : public SharedControlBlock{
+        alignas(T) unsigned char m_storage[sizeof(T)];
+
+        void destroyObject() noexcept override { get()->~T();}
+        void destroyBlock() noexcept override { delete this;}
+    public:
+        template<typename... Args>
+        explicit InplaceControlBlock(Args &&... args){ ::new(static_cast<void *>(m_storage)) T(std::forward<Args>(args)...);}
+        T * get() noexcept { return std::launder(reinterpret_cast<T *>(m_storage));}
+    };
+    // an object allocated elsewhere, released through its deleter
+    template<typename T, typename Deleter>
+    class PointerControlBlock final : public SharedControlBlock{
+        T * m_owned{};
+        Deleter m_deleter;
+
+        void destroyObject() noexcept override { m_deleter(m_owned);}
+        void destroyBlock() noexcept override { delete this;}
+    public:
+        PointerControlBlock(T * owned, Deleter deleter) : m_owned{owned}, m_deleter{ std::move(deleter)}{}
+    };
+
+    template<typename T>
+    class WeakPointer;
+
+    template<typename T>
+    class SharedPointer{
+        T * m_ptr{ nullptr};
+        SharedControlBlock * m_control{ nullptr};
+
+        template<typename Y> friend class SharedPointer;
+        template<typename Y> friend class WeakPointer;
+        template<typename Y, typename... Args> friend SharedPointer<Y> makeShared(Args &&... args);
+
+        // takes over a strong reference the caller already holds
+        struct Adopt{};
+        SharedPointer(Adopt, T * ptr, SharedControlBlock * control) noexcept : m_ptr{ptr}, m_control{control}{}
+        template<typename Y>
+        using Compatible = std::enable_if_t<std::is_convertible_v<Y *, T *>>;
+    public:
+        using element_type = T;
+
+        SharedPointer() noexcept = default;
+        SharedPointer(std::nullptr_t) noexcept {}
+        template<typename Y, typename = Compatible<Y>>
+        explicit SharedPointer(Y * ptr) : SharedPointer{ ptr, std::default_delete<Y>{}}{}
+        // if the block can't be allocated, ptr is released with the deleter and bad_alloc is thrown
+        template<typename Y, typename Deleter, typename = Compatible<Y>>
+        SharedPointer(Y * ptr, Deleter deleter) : m_ptr{ptr}{
+            try{
+                m_control = new PointerControlBlock<Y, Deleter>{ ptr, deleter};
+            }catch(...){
+                deleter(ptr);
+                throw;
+            }
+        }
+        template<typename Y, typename Deleter, typename = Compatible<Y>>
+        SharedPointer(std::unique_ptr<Y, Deleter> && owner){
+            if(owner){// owner keeps the object if the block can't be allocated
+                m_control = new PointerControlBlock<Y, Deleter>{ owner.get(), owner.get_deleter()};
+                m_ptr = owner.release();
+            }
+        }
+        // aliasing: shares ownership with r, points at ptr (typically a part of *r)
+        template<typename Y>
+        SharedPointer(const SharedPointer<Y> & r, T * ptr) noexcept : m_ptr{ptr}, m_control{r.m_control}{
+            if(m_control)
+                m_control->addStrong();
+        }
+        template<typename Y>
+        SharedPointer(SharedPointer<Y> && r, T * ptr) noexcept : m_ptr{ptr}, m_control{r.m_control}{
+            r.m_ptr = nullptr;
+            r.m_control = nullptr;
+        }
+        SharedPointer(const SharedPointer & src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            if(m_control)
+                m_control->addStrong();
+        }
+        SharedPointer(SharedPointer && src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            src.m_ptr = nullptr;
+            src.m_control = nullptr;
+        }
+        template<typename Y, typename = Compatible<Y>>
+        SharedPointer(const SharedPointer<Y> & src) noexcept : SharedPointer{ src, static_cast<T *>(src.m_ptr)}{}
+        template<typename Y, typename = Compatible<Y>>
+        SharedPointer(SharedPointer<Y> && src) noexcept : SharedPointer{ std::move(src), static_cast<T *>(src.m_ptr)}{}
+        ~SharedPointer(){
+            if(m_control)
+                m_control->releaseStrong();
+        }
+        SharedPointer & operator=(const SharedPointer & src) noexcept {
+            SharedPointer{ src}.swap(*this);
+            return *this;
+        }
+        SharedPointer & operator=(SharedPointer && src) noexcept {
+            SharedPointer{ std::move(src)}.swap(*this);
+            return *this;
+        }
+        void swap(SharedPointer & other) noexcept {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_control, other.m_control);
+        }
+        void reset() noexcept { SharedPointer{}.swap(*this);}
+        template<typename Y>
+        void reset(Y * ptr){ SharedPointer{ ptr}.swap(*this);}
+
+        T * get() const noexcept { return m_ptr;}
+        T & operator*() const noexcept { return *m_ptr;}
+        T * operator->() const noexcept { return m_ptr;}
+        explicit operator bool() const noexcept { return m_ptr != nullptr;}
+        long useCount() const noexcept { return m_control ? m_control->useCount() : 0;}
+        // same block, whatever they point at
+        template<typename Y>
+        bool sharesOwnershipWith(const SharedPointer<Y> & other) const noexcept { return m_control == other.m_control;}
+
+        friend bool operator==(const SharedPointer & a, const SharedPointer & b) noexcept { return a.m_ptr == b.m_ptr;}
+        friend bool operator!=(const SharedPointer & a, const SharedPointer & b) noexcept { return a.m_ptr != b.m_ptr;}
+        friend bool operator==(const SharedPointer & a, std::nullptr_t) noexcept { return !a;}
+        friend bool operator!=(const SharedPointer & a, std::nullptr_t) noexcept { return static_cast<bool>(a);}
+    };
+
+    template<typename T, typename... Args>
+    SharedPointer<T> makeShared(Args &&... args){
+        auto * control{ new InplaceControlBlock<T>{ std::forward<Args>(args)...}};
+        return { typename SharedPointer<T>::Adopt{}, control->get(), control};
+    }
+
+    template<typename T>
+    class WeakPointer{
+        T * m_ptr{ nullptr};
+        SharedControlBlock * m_control{ nullptr};
+
+        template<typename Y> friend class WeakPointer;
+    public:
+        WeakPointer() noexcept = default;
+        template<typename Y, typename = std::enable_if_t<std::is_convertible_v<Y *, T *>>>
+        WeakPointer(const SharedPointer<Y> & owner) noexcept : m_ptr{ owner.m_ptr}, m_control{ owner.m_control}{
+            if(m_control)
+                m_control->addWeak();
+        }
+        WeakPointer(const WeakPointer & src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            if(m_control)
+                m_control->addWeak();
+        }
+        WeakPointer(WeakPointer && src) noexcept : m_ptr{src.m_ptr}, m_control{src.m_control}{
+            src.m_ptr = nullptr;
+            src.m_control = nullptr;
+        }
+        ~WeakPointer(){
+            if(m_control)
+                m_control->releaseWeak();
+        }
+        WeakPointer & operator=(const WeakPointer & src) noexcept {
+            WeakPointer{ src}.swap(*this);
+            return *this;
+        }
+        WeakPointer & operator=(WeakPointer && src) noexcept {
+            WeakPointer{ std::move(src)}.swap(*this);
+            return *this;
+        }
+        template<typename Y, typename = std::enable_if_t<std::is_convertible_v<Y *, T *>>>
+        WeakPointer & operator=(const SharedPointer<Y> & owner) noexcept {
+            WeakPointer{ owner}.swap(*this);
+            return *this;
+        }
+        void swap(WeakPointer & other) noexcept {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_control, other.m_control);
+        }
+        void reset() noexcept { WeakPointer{}.swap(*this);}
+
+        SharedPointer<T> lock() const noexcept {
+            if(m_control && m_control->tryAddStrong())
+                return { typename SharedPointer<T>::Adopt{}, m_ptr, m_control};
+            return {};
+        }
+        bool expired() const noexcept { return useCount() == 0;}
+        long useCount() const noexcept { return m_control ? m_control->useCount() : 0;}
+    };
+#endif
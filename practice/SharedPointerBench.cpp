@@ -0,0 +1,168 @@
+/*
+    SharedPointer / WeakPointer (SharedPointer.h) vs std::shared_ptr / std::weak_ptr:
+    heap allocations per pointer created (counted by replacing global operator new), and ns for
+    create + destroy, copy + destroy, and weak lock + release.
+    libstdc++ switches its counts to plain (non atomic) increments while a program has never started
+    a thread (__libc_single_threaded), so the timings run twice: before and after a thread has been
+    started. SharedPointer is always atomic.
+    Then a stress run of the last release racing a lock(): thread A drops the only SharedPointer while
+    thread B locks its WeakPointer, drops the WeakPointer and keeps using the locked object. The object
+    has to outlive B's use and be destroyed exactly once per round.
+
+    build: g++ -std=c++17 -O2 -pthread SharedPointerBench.cpp
+    usage: SharedPointerBench [pointers] [repeats] [stress rounds]
+*/
+#include<iostream>
+#include<vector>
+#include<memory>
+#include<algorithm>
+#include<chrono>
+#include<thread>
+#include<atomic>
+#include<cstdlib>
+#include<new>
+#include"SharedPointer.h"
+
+static std::size_t g_allocations{};
+void * operator new(std::size_t size){
+    ++g_allocations;
+    if(void * p{ std::malloc(size ? size : 1)})
+        return p;
+    throw std::bad_alloc{};
+}
+// not inlined into the library's sized deletes, where GCC would see free() on an operator new pointer
+[[gnu::noinline]] void operator delete(void * p) noexcept { std::free(p);}
+void operator delete(void * p, std::size_t) noexcept { operator delete(p);}
+
+struct Resource{
+    int m_value{};
+    explicit Resource(int value) : m_value{value}{}
+};
+template<typename Func>
+std::size_t allocationsOf(Func && func){
+    const std::size_t before{ g_allocations};
+    func();
+    return g_allocations - before;
+}
+// best of 5 runs, this VM is noisy
+template<typename Func>
+double nsPer(std::size_t count, Func && func){
+    double best{ 1e300};
+    for(int run{}; run < 5; ++run){
+        auto start{ std::chrono::steady_clock::now()};
+        func();
+        std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start};
+        best = std::min(best, elapsed.count() / static_cast<double>(count));
+    }
+    return best;
+}
+
+// Pointer / Weak: the pointer types; make: creates a Pointer to Resource{ value}
+template<typename Pointer, typename Weak, typename Make>
+void timeAll(const char * name, std::size_t count, int repeats, Make && make, long long & sink){
+    const std::size_t total{ count * static_cast<std::size_t>(repeats)};
+    std::vector<Pointer> source(count), copies(count);
+    double create{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r){
+            for(std::size_t i{}; i < count; ++i)
+                source[i] = make(static_cast<int>(i));
+            sink += source.back()->m_value;
+        }
+    })};
+    double copy{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r){
+            for(std::size_t i{}; i < count; ++i)
+                copies[i] = source[i];
+            sink += copies.back()->m_value;
+            for(auto & pointer : copies)
+                pointer = nullptr;
+        }
+    })};
+    std::vector<Weak> weak(source.begin(), source.end());
+    double lock{ nsPer(total, [&]{
+        for(int r{}; r < repeats; ++r)
+            for(const auto & w : weak)
+                if(auto locked{ w.lock()})
+                    sink += locked->m_value;
+    })};
+    std::cout<<"  "<<name<<": create+destroy "<<create<<", copy+destroy "<<copy<<", lock+release "<<lock<<"\n";
+}
+// counts live objects; the destructor poisons the value so a use after the last release shows
+struct Tracked{
+    static inline std::atomic<long> s_live{};
+    volatile int m_value{};
+    explicit Tracked(int value) : m_value{value}{ s_live.fetch_add(1, std::memory_order_relaxed);}
+    ~Tracked(){
+        m_value = -1;
+        s_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+// false if B ever saw a destroyed object or objects were not destroyed exactly once
+bool stressLastRelease(int rounds){
+    bool ok{ true};
+    for(int round{}; round < rounds; ++round){
+        auto owner{ makeShared<Tracked>(round)};
+        WeakPointer<Tracked> weak{ owner};
+        std::atomic<bool> go{ false};
+        std::atomic<bool> seen{ true};
+        std::thread b{ [&go, &seen, round, weak = std::move(weak)]() mutable {
+            while(!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            SharedPointer<Tracked> locked{ weak.lock()};
+            weak.reset();
+            for(int i{}; locked && i < 4; ++i){
+                std::this_thread::yield();
+                if(locked->m_value != round)
+                    seen.store(false, std::memory_order_relaxed);
+            }
+        }};
+        go.store(true, std::memory_order_release);
+        for(int i{ round % 3}; i > 0; --i)
+            std::this_thread::yield();
+        owner.reset();
+        b.join();
+        ok = ok && seen.load() && Tracked::s_live.load() == 0;
+    }
+    return ok;
+}
+int main(int argc, char * argv[]){
+    std::size_t count{ argc > 1 ? std::stoul(argv[1]) : 100'000};
+    int repeats{ argc > 2 ? std::stoi(argv[2]) : 10};
+    int rounds{ argc > 3 ? std::stoi(argv[3]) : 20'000};
+    bool ok{ true};
+
+    std::cout<<"heap allocations per pointer: std / SharedPointer\n";
+    std::size_t stdMake{ allocationsOf([]{ auto p{ std::make_shared<Resource>(1)};})};
+    std::size_t ownMake{ allocationsOf([]{ auto p{ makeShared<Resource>(1)};})};
+    std::size_t stdNew{ allocationsOf([]{ std::shared_ptr<Resource> p{ new Resource{1}};})};
+    std::size_t ownNew{ allocationsOf([]{ SharedPointer<Resource> p{ new Resource{1}};})};
+    std::size_t stdCopy{}, ownCopy{};
+    {
+        auto a{ std::make_shared<Resource>(1)};
+        auto b{ makeShared<Resource>(1)};
+        stdCopy = allocationsOf([&]{ auto c{ a}; std::weak_ptr<Resource> w{ c}; auto l{ w.lock()};});
+        ownCopy = allocationsOf([&]{ auto c{ b}; WeakPointer<Resource> w{ c}; auto l{ w.lock()};});
+    }
+    std::cout<<"  make_shared / makeShared : "<<stdMake<<" / "<<ownMake<<"\n"
+             <<"  from new                 : "<<stdNew<<" / "<<ownNew<<"\n"
+             <<"  copy, weak, lock         : "<<stdCopy<<" / "<<ownCopy<<"\n";
+    ok = ownMake == 1 && ownNew == 2 && ownCopy == 0;
+
+    long long sink{};
+    std::cout<<count<<" pointers x "<<repeats<<", ns per pointer, best of 5\nno thread started yet\n";
+    timeAll<std::shared_ptr<Resource>, std::weak_ptr<Resource>>("std::shared_ptr", count, repeats,
+        [](int value){ return std::make_shared<Resource>(value);}, sink);
+    timeAll<SharedPointer<Resource>, WeakPointer<Resource>>("SharedPointer  ", count, repeats,
+        [](int value){ return makeShared<Resource>(value);}, sink);
+    std::thread{ []{}}.join();
+    std::cout<<"after a thread was started\n";
+    timeAll<std::shared_ptr<Resource>, std::weak_ptr<Resource>>("std::shared_ptr", count, repeats,
+        [](int value){ return std::make_shared<Resource>(value);}, sink);
+    timeAll<SharedPointer<Resource>, WeakPointer<Resource>>("SharedPointer  ", count, repeats,
+        [](int value){ return makeShared<Resource>(value);}, sink);
+
+    std::cout<<(ok ? "allocation counts as expected\n" : "UNEXPECTED ALLOCATIONS\n")<<(sink == 1 ? " " : "");
+    const bool stressOk{ stressLastRelease(rounds)};
+    std::cout<<rounds<<" rounds of last release vs lock + weak release: "<<(stressOk ? "ok\n" : "OBJECT USED AFTER RELEASE\n");
+    return ok && stressOk ? 0 : 1;
+}
@@ -0,0 +1,333 @@
+#ifndef __SPATIALINDEX_H
+#define __SPATIALINDEX_H
+    /*
+        Spatial indexes over Point2d, so radius & nearest queries stop being brute force scans
+        (Point2d::distanceTo per point, or PointCloud.h's batch version).
+
+        PointGrid: uniform grid hash, for points that come, go and move
+        > the plane is cut in square cells of cellSize; cell (cx, cy) hashes to one of a power of two
+          number of buckets. Each bucket is a singly linked list threaded through one entry array
+          (no allocation per point), an entry remembers its cell so collisions are filtered out
+        > insert / remove / move by caller chosen 32 bit id; remove fills the hole with the last entry
+        > rebuild(): bulk load with a counting sort by bucket, so each bucket's entries end up
+          contiguous in memory (also done when the table grows past 2 entries per bucket)
+        > radius(): visits the cells overlapping the query square; nearest(): rings of cells around
+          the query until the next ring can't hold anything closer than the current k-th
+        > pick cellSize around the typical query radius, or so that a cell holds a few points
+
+        KdTree: static 2-d tree, built once from a point set with nth_element
+        > implicit layout: one array of {x, y, id}; a range's middle element is the splitting node
+          (median on x, then y, alternating), ranges of up to 8 points are leaves scanned linearly.
+          No child pointers, 24 bytes per point
+        > radius() & nearest() descend the near side first and skip a far side that lies beyond the
+          radius / the current k-th distance
+
+        Both return ids (the index into the vector given to rebuild/build, or the id given to insert);
+        nearest() lists are closest first, with ties going to the lower id, same as PointCloud::nearest.
+    */
+    #include<algorithm>
+    #include<cmath>
+    #include<cstdint>
+    #include<limits>
+    #include<vector>
+    #include"Point2d.h"
+    #include"PointCloud.h"
+
+    class PointGrid{
+        struct Entry{
+            double x{};
+            double y{};
+            std::int32_t cellX{};
+            std::int32_t cellY{};
+            std::uint32_t id{};
+            std::int32_t next{ -1};// next entry in the same bucket
+        };
+        static constexpr std::int32_t none{ -1};
+        double m_cellSize{};
+        double m_inverseCellSize{};
+        int m_shift{};// 64 - log2(bucket count)
+        std::vector<std::int32_t> m_heads{};// first entry of each bucket
+        std::vector<Entry> m_entries{};
+        std::vector<std::int32_t> m_entryOf{};// by id
+        // cell range holding points (never shrinks on remove, it only bounds the searches)
+        std::int32_t m_minCellX{ std::numeric_limits<std::int32_t>::max()};
+        std::int32_t m_minCellY{ std::numeric_limits<std::int32_t>::max()};
+        std::int32_t m_maxCellX{ std::numeric_limits<std::int32_t>::min()};
+        std::int32_t m_maxCellY{ std::numeric_limits<std::int32_t>::min()};
+
+        std::int32_t cellOf(double v) const { return static_cast<std::int32_t>(std::floor(v * m_inverseCellSize));}
+        std::size_t bucketOf(std::int32_t cellX, std::int32_t cellY) const {
+            const std::uint64_t key{ static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32
+                                   | static_cast<std::uint32_t>(cellY)};
+            return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> m_shift);
+        }
+        void growBounds(std::int32_t cellX, std::int32_t cellY){
+            m_minCellX = std::min(m_minCellX, cellX);
+            m_minCellY = std::min(m_minCellY, cellY);
+            m_maxCellX = std::max(m_maxCellX, cellX);
+            m_maxCellY = std::max(m_maxCellY, cellY);
+        }
+        // the link that points at entry e: a bucket head or the previous entry's next
+        std::int32_t & linkTo(std::int32_t e){
+            std::int32_t * link{ &m_heads[bucketOf(m_entries[e].cellX, m_entries[e].cellY)]};
+            while(*link != e)
+                link = &m_entries[*link].next;
+            return *link;
+        }
+        // counting sort of the entries by bucket, then every bucket is one contiguous run
+        void rehash(std::size_t bucketCount){
+            std::size_t buckets{ 16};
+            int bits{ 4};
+            while(buckets < bucketCount){
+                buckets *= 2;
+                ++bits;
+            }
+            m_shift = 64 - bits;
+            std::vector<std::int32_t> start(buckets + 1, 0);
+            for(const Entry & entry : m_entries)
+                ++start[bucketOf(entry.cellX, entry.cellY) + 1];
+            for(std::size_t b{}; b < buckets; ++b)
+                start[b + 1] += start[b];
+            std::vector<Entry> sorted(m_entries.size());
+            std::vector<std::int32_t> fill(start.begin(), start.end() - 1);
+            for(const Entry & entry : m_entries)
+                sorted[static_cast<std::size_t>(fill[bucketOf(entry.cellX, entry.cellY)]++)] = entry;
+            m_heads.assign(buckets, none);
+            for(std::size_t b{}; b < buckets; ++b){
+                if(start[b] == start[b + 1])
+                    continue;
+                m_heads[b] = start[b];
+                for(std::int32_t e{ start[b]}; e < start[b + 1]; ++e)
+                    sorted[static_cast<std::size_t>(e)].next = e + 1 < start[b + 1] ? e + 1 : none;
+            }
+            m_entries = std::move(sorted);
+            for(std::size_t e{}; e < m_entries.size(); ++e)
+                m_entryOf[m_entries[e].id] = static_cast<std::int32_t>(e);
+        }
+        template<typename Func>
+        void forEachInCell(std::int32_t cellX, std::int32_t cellY, Func && func) const {
+            for(std::int32_t e{ m_heads[bucketOf(cellX, cellY)]}; e != none; e = m_entries[static_cast<std::size_t>(e)].next){
+                const Entry & entry{ m_entries[static_cast<std::size_t>(e)]};
+                if(entry.cellX == cellX && entry.cellY == cellY)
+                    func(entry);
+            }
+        }
+    public:
+        explicit PointGrid(double cellSize, std::size_t bucketCount = 1024)
+            : m_cellSize{cellSize}, m_inverseCellSize{ 1.0 / cellSize}{
+            rehash(bucketCount);
+        }
+        std::size_t size() const { return m_entries.size();}
+        double getCellSize() const { return m_cellSize;}
+        bool contains(std::uint32_t id) const { return id < m_entryOf.size() && m_entryOf[id] != none;}
+
+        // ids are the indices into points
+        void rebuild(const std::vector<Point2d> & points){
+            m_entries.resize(points.size());
+            m_entryOf.assign(points.size(), none);
+            m_minCellX = m_minCellY = std::numeric_limits<std::int32_t>::max();
+            m_maxCellX = m_maxCellY = std::numeric_limits<std::int32_t>::min();
+            for(std::size_t i{}; i < points.size(); ++i){
+                Entry & entry{ m_entries[i]};
+                entry = { points[i].getX(), points[i].getY(), cellOf(points[i].getX()), cellOf(points[i].getY()),
+                          static_cast<std::uint32_t>(i), none};
+                growBounds(entry.cellX, entry.cellY);
+            }
+            rehash(points.size());
+        }
+        // id must not be in the grid yet
+        void insert(std::uint32_t id, const Point2d & point){
+            if(id >= m_entryOf.size())
+                m_entryOf.resize(id + 1, none);
+            Entry entry{ point.getX(), point.getY(), cellOf(point.getX()), cellOf(point.getY()), id, none};
+            growBounds(entry.cellX, entry.cellY);
+            std::int32_t & head{ m_heads[bucketOf(entry.cellX, entry.cellY)]};
+            entry.next = head;
+            head = static_cast<std::int32_t>(m_entries.size());
+            m_entryOf[id] = head;
+            m_entries.push_back(entry);
+            if(m_entries.size() > 2 * m_heads.size())
+                rehash(2 * m_heads.size());
+        }
+        bool remove(std::uint32_t id){
+            if(!contains(id))
+                return false;
+            const std::int32_t e{ m_entryOf[id]};
+            linkTo(e) = m_entries[static_cast<std::size_t>(e)].next;
+            m_entryOf[id] = none;
+            const std::int32_t last{ static_cast<std::int32_t>(m_entries.size() - 1)};
+            if(e != last){// the last entry moves into the hole
+                linkTo(last) = e;
+                m_entries[static_cast<std::size_t>(e)] = m_entries.back();
+                m_entryOf[m_entries[static_cast<std::size_t>(e)].id] = e;
+            }
+            m_entries.pop_back();
+            return true;
+        }
+        void move(std::uint32_t id, const Point2d & point){
+            if(contains(id)){
+                Entry & entry{ m_entries[static_cast<std::size_t>(m_entryOf[id])]};
+                if(entry.cellX == cellOf(point.getX()) && entry.cellY == cellOf(point.getY())){
+                    entry.x = point.getX();
+                    entry.y = point.getY();
+                    return;
+                }
+                remove(id);
+            }
+            insert(id, point);
+        }
+
+        // ids of the points within radius (distance <= radius), in no particular order
+        void radius(const Point2d & from, double radius, std::vector<std::uint32_t> & out) const {
+            out.clear();
+            if(m_entries.empty())
+                return;
+            const double limit{ radius * radius};
+            const std::int32_t x0{ std::max(cellOf(from.getX() - radius), m_minCellX)};
+            const std::int32_t x1{ std::min(cellOf(from.getX() + radius), m_maxCellX)};
+            const std::int32_t y0{ std::max(cellOf(from.getY() - radius), m_minCellY)};
+            const std::int32_t y1{ std::min(cellOf(from.getY() + radius), m_maxCellY)};
+            for(std::int32_t cy{ y0}; cy <= y1; ++cy){
+                for(std::int32_t cx{ x0}; cx <= x1; ++cx){
+                    forEachInCell(cx, cy, [&](const Entry & entry){
+                        const double dx{ entry.x - from.getX()};
+                        const double dy{ entry.y - from.getY()};
+                        if(dx * dx + dy * dy <= limit)
+                            out.push_back(entry.id);
+                    });
+                }
+            }
+        }
+        std::vector<Neighbor> nearest(const Point2d & from, std::size_t k) const {
+            NearestK best{ std::min(k, size())};
+            if(m_entries.empty() || k == 0)
+                return best.take();
+            const std::int64_t centerX{ cellOf(from.getX())};
+            const std::int64_t centerY{ cellOf(from.getY())};
+            auto visit{ [&](std::int32_t cx, std::int32_t cy){
+                forEachInCell(cx, cy, [&](const Entry & entry){
+                    const double dx{ entry.x - from.getX()};
+                    const double dy{ entry.y - from.getY()};
+                    best.offer({ dx * dx + dy * dy, entry.id});
+                });
+            }};
+            // rings closer than the occupied cells are empty, start at the first one that isn't
+            const std::int64_t gapX{ std::max<std::int64_t>({ m_minCellX - centerX, centerX - m_maxCellX, 0})};
+            const std::int64_t gapY{ std::max<std::int64_t>({ m_minCellY - centerY, centerY - m_maxCellY, 0})};
+            const std::int64_t farthest{ std::max({ centerX - m_minCellX, m_maxCellX - centerX,
+                                                    centerY - m_minCellY, m_maxCellY - centerY})};
+            for(std::int64_t ring{ std::max(gapX, gapY)}; ring <= farthest; ++ring){
+                // the ring's top & bottom rows, then its columns without the corners, clipped to the occupied cells
+                const std::int64_t x0{ std::max<std::int64_t>(centerX - ring, m_minCellX)};
+                const std::int64_t x1{ std::min<std::int64_t>(centerX + ring, m_maxCellX)};
+                for(std::int64_t cy : { centerY - ring, centerY + ring}){
+                    if(cy >= m_minCellY && cy <= m_maxCellY)
+                        for(std::int64_t cx{ x0}; cx <= x1; ++cx)
+                            visit(static_cast<std::int32_t>(cx), static_cast<std::int32_t>(cy));
+                    if(ring == 0)
+                        break;
+                }
+                const std::int64_t y0{ std::max<std::int64_t>(centerY - ring + 1, m_minCellY)};
+                const std::int64_t y1{ std::min<std::int64_t>(centerY + ring - 1, m_maxCellY)};
+                for(std::int64_t cx : { centerX - ring, centerX + ring}){
+                    if(ring == 0 || cx < m_minCellX || cx > m_maxCellX)
+                        continue;
+                    for(std::int64_t cy{ y0}; cy <= y1; ++cy)
+                        visit(static_cast<std::int32_t>(cx), static_cast<std::int32_t>(cy));
+                }
+                // everything beyond this ring is at least ring cells away from the query's cell
+                const double reach{ static_cast<double>(ring) * m_cellSize};
+                if(best.full() && best.bound() < reach * reach)
+                    break;
+            }
+            return best.take();
+        }
+        std::size_t memoryBytes() const {
+            return m_heads.capacity() * sizeof(std::int32_t) + m_entries.capacity() * sizeof(Entry)
+                 + m_entryOf.capacity() * sizeof(std::int32_t);
+        }
+    };
+
+    class KdTree{
+        struct Item{
+            double x{};
+            double y{};
+            std::uint32_t id{};
+        };
+        static constexpr std::size_t leafSize{ 8};
+        std::vector<Item> m_items{};
+
+        static double coordinate(const Item & item, int axis){ return axis ? item.y : item.x;}
+        void build(std::size_t first, std::size_t last, int axis){
+            if(last - first <= leafSize)
+                return;
+            const std::size_t middle{ first + (last - first) / 2};
+            std::nth_element(m_items.begin() + static_cast<std::ptrdiff_t>(first), m_items.begin() + static_cast<std::ptrdiff_t>(middle),
+                             m_items.begin() + static_cast<std::ptrdiff_t>(last), [axis](const Item & a, const Item & b){
+                return coordinate(a, axis) < coordinate(b, axis);
+            });
+            build(first, middle, axis ^ 1);
+            build(middle + 1, last, axis ^ 1);
+        }
+        template<typename Visit, typename Reach>
+        void descend(std::size_t first, std::size_t last, int axis, const Point2d & from, Visit & visit, Reach & reach) const {
+            if(last - first <= leafSize){
+                for(std::size_t i{ first}; i < last; ++i)
+                    visit(m_items[i]);
+                return;
+            }
+            const std::size_t middle{ first + (last - first) / 2};
+            const Item & split{ m_items[middle]};
+            visit(split);
+            const double diff{ (axis ? from.getY() : from.getX()) - coordinate(split, axis)};
+            if(diff < 0){
+                descend(first, middle, axis ^ 1, from, visit, reach);
+                if(diff * diff <= reach())
+                    descend(middle + 1, last, axis ^ 1, from, visit, reach);
+            }else{
+                descend(middle + 1, last, axis ^ 1, from, visit, reach);
+                if(diff * diff <= reach())
+                    descend(first, middle, axis ^ 1, from, visit, reach);
+            }
+        }
+    public:
+        KdTree() = default;
+        explicit KdTree(const std::vector<Point2d> & points){ rebuild(points);}
+        // ids are the indices into points
+        void rebuild(const std::vector<Point2d> & points){
+            m_items.resize(points.size());
+            for(std::size_t i{}; i < points.size(); ++i)
+                m_items[i] = { points[i].getX(), points[i].getY(), static_cast<std::uint32_t>(i)};
+            build(0, m_items.size(), 0);
+        }
+        std::size_t size() const { return m_items.size();}
+
+        // ids of the points within radius (distance <= radius), in no particular order
+        void radius(const Point2d & from, double radius, std::vector<std::uint32_t> & out) const {
+            out.clear();
+            const double limit{ radius * radius};
+            auto visit{ [&](const Item & item){
+                const double dx{ item.x - from.getX()};
+                const double dy{ item.y - from.getY()};
+                if(dx * dx + dy * dy <= limit)
+                    out.push_back(item.id);
+            }};
+            auto reach{ [limit]{ return limit;}};
+            if(!m_items.empty())
+                descend(0, m_items.size(), 0, from, visit, reach);
+        }
+        std::vector<Neighbor> nearest(const Point2d & from, std::size_t k) const {
+            NearestK best{ std::min(k, size())};
+            auto visit{ [&](const Item & item){
+                const double dx{ item.x - from.getX()};
+                const double dy{ item.y - from.getY()};
+                best.offer({ dx * dx + dy * dy, item.id});
+            }};
+            auto reach{ [&best]{ return best.bound();}};
+            if(!m_items.empty() && k != 0)
+                descend(0, m_items.size(), 0, from, visit, reach);
+            return best.take();
+        }
+        std::size_t memoryBytes() const { return m_items.capacity() * sizeof(Item);}
+    };
+#endif
@@ -0,0 +1,115 @@
+/*
+    PointGrid & KdTree (SpatialIndex.h): build time, radius / k-nearest query latency and memory
+    per point from 1e5 up to 1e7 uniformly spread points. Query results are checked against the
+    brute force PointCloud kernels (PointCloud.h), also after moving, removing & re-inserting
+    points in the grid.
+
+    build: g++ -std=c++17 -O3 -march=native -fno-math-errno SpatialIndexBench.cpp
+    usage: SpatialIndexBench [maxPoints] [queries] [k]
+*/
+#include<iostream>
+#include<iomanip>
+#include<vector>
+#include<chrono>
+#include<cmath>
+#include<algorithm>
+#include"SpatialIndex.h"
+#include"Random.h"
+
+constexpr double side{ 1000.0};// points in [0, side)^2
+
+template<typename Func>
+double seconds(Func && func){
+    auto start{ std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start};
+    return elapsed.count();
+}
+bool sameNeighbors(const std::vector<Neighbor> & a, const std::vector<Neighbor> & b){
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const Neighbor & x, const Neighbor & y){
+        return x.index == y.index && x.squaredDistance == y.squaredDistance;
+    });
+}
+// radius results are unordered: compare as sets against the brute force count
+template<typename Index>
+bool check(const Index & index, const std::vector<Point2d> & points, const std::vector<Point2d> & queries,
+           double radius, std::size_t k){
+    const PointCloud cloud{ points};
+    std::vector<std::uint32_t> found{};
+    for(const auto & q : queries){
+        index.radius(q, radius, found);
+        std::sort(found.begin(), found.end());
+        const bool inside{ std::all_of(found.begin(), found.end(), [&](std::uint32_t id){
+            const double dx{ points[id].getX() - q.getX()}, dy{ points[id].getY() - q.getY()};
+            return dx * dx + dy * dy <= radius * radius;
+        })};
+        if(!inside || std::adjacent_find(found.begin(), found.end()) != found.end() || found.size() != cloud.countWithin(q, radius))
+            return false;
+        if(!sameNeighbors(index.nearest(q, k), cloud.nearest(q, k)))
+            return false;
+    }
+    return true;
+}
+template<typename Index>
+void queryLatency(const char * name, const Index & index, const std::vector<Point2d> & queries, double radius, std::size_t k){
+    std::vector<std::uint32_t> found{};
+    std::size_t hits{}, neighbors{};
+    double radiusTime{ seconds([&]{
+        for(const auto & q : queries){
+            index.radius(q, radius, found);
+            hits += found.size();
+        }
+    })};
+    double nearestTime{ seconds([&]{
+        for(const auto & q : queries)
+            neighbors += index.nearest(q, k).size();
+    })};
+    std::cout<<"    "<<name<<" radius "<<radiusTime / queries.size() * 1e6<<" us ("
+             <<static_cast<double>(hits) / queries.size()<<" hits avg), "<<k<<"-nearest "<<nearestTime / queries.size() * 1e6<<" us\n";
+}
+int main(int argc, char * argv[]){
+    std::size_t maxPoints{ argc > 1 ? std::stoul(argv[1]) : 10'000'000};
+    std::size_t queryCount{ argc > 2 ? std::stoul(argv[2]) : 20'000};
+    std::size_t k{ argc > 3 ? std::stoul(argv[3]) : 8};
+    bool ok{ true};
+    std::cout<<std::setprecision(3);
+    for(std::size_t n{ 100'000}; n <= maxPoints; n *= 10){
+        Random rng{ n};
+        std::vector<Point2d> points(n);
+        for(auto & point : points)
+            point = { rng.getDouble() * side, rng.getDouble() * side};
+        std::vector<Point2d> queries(queryCount);
+        for(auto & point : queries)
+            point = { rng.getDouble() * side, rng.getDouble() * side};
+        // about 2 points per cell; the radius covers about 20 points
+        const double cellSize{ std::sqrt(2.0 * side * side / n)};
+        const double radius{ std::sqrt(20.0 * side * side / n / 3.14159)};
+
+        PointGrid grid{ cellSize};
+        KdTree tree{};
+        double gridBuild{ seconds([&]{ grid.rebuild(points);})};
+        double treeBuild{ seconds([&]{ tree.rebuild(points);})};
+        std::cout<<n<<" points\n"
+                 <<"  build: grid "<<gridBuild * 1e3<<" ms, k-d tree "<<treeBuild * 1e3<<" ms\n"
+                 <<"  memory: grid "<<static_cast<double>(grid.memoryBytes()) / n<<" bytes/point, k-d tree "
+                 <<static_cast<double>(tree.memoryBytes()) / n<<" bytes/point (points alone: "<<sizeof(Point2d)<<")\n";
+        queryLatency("grid     ", grid, queries, radius, k);
+        queryLatency("k-d tree ", tree, queries, radius, k);
+
+        std::vector<Point2d> sample(queries.begin(), queries.begin() + std::min<std::size_t>(queries.size(), 20));
+        bool good{ check(grid, points, sample, radius, k) && check(tree, points, sample, radius, k)};
+        // dynamic grid: move 1% of the points, remove & re-insert another 1%
+        for(std::size_t i{}; i < n / 100; ++i){
+            std::size_t id{ static_cast<std::size_t>(rng.next() % n)};
+            points[id] = { rng.getDouble() * side, rng.getDouble() * side};
+            grid.move(static_cast<std::uint32_t>(id), points[id]);
+            id = static_cast<std::size_t>(rng.next() % n);
+            grid.remove(static_cast<std::uint32_t>(id));
+            grid.insert(static_cast<std::uint32_t>(id), points[id]);
+        }
+        good = good && grid.size() == n && check(grid, points, sample, radius, k);
+        std::cout<<(good ? "  matches brute force, also after grid updates\n" : "  MISMATCH with brute force\n");
+        ok = ok && good;
+    }
+    return ok ? 0 : 1;
+}
@@ -1,20 +1,7 @@
 #include<iostream>
 #include<string>
-template<class T1, class  T2>
-class Pair{
-    T1 m_first;
-    T2 m_second;
-public:
-    Pair(const T1 & first, const T2 & second): m_first{first}, m_second{second}{}
-    const T1 & first()   const { return m_first;}
-    const  T2 & second() const { return m_second;}
-};
-template<class T>
-class StringValuePair: public Pair<std::string, T>{
-public :
-    StringValuePair(const std::string & first, const T & second)
-    : Pair<std::string, T>{first, second}{}
-};
+#include"FlatStringMap.h"
+#include"Pair.h"
 int main()
 {
 	Pair<int, double> p1(5, 6.7);
@@ -25,5 +12,18 @@ int main()
  
     StringValuePair<int> svp("Hello", 5);
 	std::cout << "Pair: " << svp.first() << ' ' << svp.second() << '\n';
+
+    // each member built from its own arguments, in place
+    Pair<std::string, std::string> p3(std::piecewise_construct, std::forward_as_tuple(3, '*'), std::forward_as_tuple("World"));
+	std::cout << "Pair: " << p3.first() << ' ' << p3.second() << '\n';
+
+	// StringValuePairs looked up by key: load, freeze, then binary search
+	FlatStringMap<int> ages{};
+	ages.insert("Alex", 31);
+	ages.insert("Betty", 25);
+	ages.insert("Hello", 5);
+	ages.freeze();
+	if(const int * age{ ages.find("Betty")})
+		std::cout << "Betty: " << *age << '\n';
 	return 0;
-}
\ No newline at end of file
+}
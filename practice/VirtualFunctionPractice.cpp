@@ -39,55 +39,17 @@ int main()
  */
 
 #include<iostream>
-class Point{
-    int m_x{};
-    int m_y{};
-    int m_z{};
-public:
-    Point(int x=0, int y=0, int z=0): m_x{x}, m_y{y}, m_z{z}{}
-    friend std::ostream& operator<<(std::ostream & out, const Point & p) {
-        out<<"Point ("<<p.m_x<<", "<<p.m_y<<", "<<p.m_z<<") ";
-        return out;
-    }
-};
-class Shape{
-public:
-    virtual std::ostream& print(std::ostream& out) const = 0;
-    friend std::ostream & operator<<(std::ostream & out, const Shape  & shape){
-       return shape.print(out);
-    }
-    virtual ~Shape(){}
-};
-
-class Circle : public Shape{
-    Point m_center{};
-    int m_radius{};
-public:
-    Circle(const Point & center , int r):m_center{center}, m_radius{r}{};
-    virtual std::ostream& print(std::ostream & out) const override{
-        out<<"Circle ( "<<m_center<<", radius "<<m_radius<<"\n";
-        return out;
-    }
-    int getRadius(){ return m_radius;}
-};
-class Triangle : public Shape{
-    Point m_p1{};
-    Point m_p2{};
-    Point m_p3{};
-public:
-    Triangle(const Point & p1, const Point & p2, const Point & p3): m_p1{p1}, m_p2{p2}, m_p3{p3}{}
-     virtual std::ostream & print(std::ostream & out) const override{
-        out<<"Triangle ( "<<m_p1<<", "<<m_p2<<", "<<m_p3<<" )\n";
-        return out;
-     }
-};
+#include"Shape.h"
+#include"ShapeList.h"
+#include"ShapeArena.h"
+#include"ShapeBatch.h"
 
 #include <vector>
  int getLargestRadius(const std :: vector<Shape *> &v ){
      int max{};
      Circle *pCircle{nullptr};
      for(auto & ele : v){
-         pCircle = dynamic_cast<Circle *>(ele);
+         pCircle = shape_cast<Circle>(ele);// a compare of the kind tag, no RTTI (dynamic_cast before)
          if(pCircle && pCircle->getRadius() > max)
             max = pCircle->getRadius();
      }
@@ -106,7 +68,36 @@ int main()
         std::cout<<*shape;
     }
     std::cout << "The largest radius is: " << getLargestRadius(v) << '\n'; // write this function
- 
+
+    // same shapes, one contiguous pool per type (ShapeList.h): no new, no dynamic_cast
+    ShapeList shapes{};
+    shapes.add(Circle{Point{1, 2, 3}, 7});
+    shapes.add(Triangle{Point{1, 2, 3}, Point{4, 5, 6}, Point{7, 8, 9}});
+    shapes.add(Circle{Point{4, 5, 6}, 3});
+    std::cout<<shapes;
+    std::cout << "The largest radius is: " << getLargestRadius(shapes) << '\n';
+
+    // area of every shape in one batch (ShapeBatch.h), in ShapeList order
+    const ShapeBatch batch{ shapes};
+    std::vector<double> areas(batch.size());
+    batch.areas(areas.data());
+    for(double area : areas)
+        std::cout << "area " << area << '\n';
+
+    // same vector<Shape*>, shapes placed in a ShapeArena (ShapeArena.h): no delete loop, the arena
+    // destroys them all when it goes out of scope
+    {
+        ShapeArena arena{};
+        std::vector<Shape*> arenaShapes{
+            arena.create<Circle>(Point{1, 2, 3}, 7),
+            arena.create<Triangle>(Point{1, 2, 3}, Point{4, 5, 6}, Point{7, 8, 9}),
+            arena.create<Circle>(Point{4, 5, 6}, 3)
+        };
+        for(auto * shape : arenaShapes)
+            std::cout<<*shape;
+        std::cout << "The largest radius is: " << getLargestRadius(arenaShapes) << '\n';
+    }
+
 	// delete each element in the vector here
     for(auto * ele : v){
         delete ele;
@@ -1,38 +1,5 @@
 #include <iostream>
- class Fraction{
-     int m_num{};
-     int m_deno{};
-public:
-    Fraction(int num =0, int deno =1):m_num{num}, m_deno{deno} {
-    }
-    void print() const{
-        std::cout<<m_num<<"/"<<m_deno<<"\n";
-    }
-    friend Fraction operator*(const Fraction & f1, const Fraction &f2);
-    friend Fraction operator*(const Fraction & f1, int mul);
-    friend Fraction operator*( int mul,const Fraction & f1);
-    friend std::ostream & operator<<(std::ostream & out , const Fraction  & fr);
-    friend std::istream & operator>>(std::istream & in ,  Fraction  & fr);
- };
-    std::ostream & operator<<(std::ostream & out , const Fraction  & fr){
-        out<<fr.m_num<<"/"<<fr.m_deno;
-        return out;
-    }
-    std::istream & operator>>(std::istream & in ,  Fraction  & fr){
-        in>>fr.m_num;
-        in.ignore(std::numeric_limits<std::streamsize>::max(),'/');
-        in>>fr.m_deno;
-        return in;
-    }
-    Fraction operator*(const Fraction & f1, const Fraction &f2){
-        return {f1.m_num *f2.m_num, f1.m_deno *f2.m_deno};
-    }
-    Fraction operator*(const Fraction & f1, int mul){
-        return {f1.m_num *mul, f1.m_deno};
-    }
-    Fraction operator*( int mul,const Fraction & f1){
-        return {f1 * mul};
-    }
+#include"Fraction.h"
 int main1()
 {
     Fraction f1{2, 5};
@@ -66,37 +33,15 @@ int main1()
 	return 0;
     return 0;
 }
-#include<string>
-#include<vector>
-#include<algorithm>
-struct StudentGrade {
-    std::string m_name{};
-    char m_grade{}      ;
-};
-class GradeMap {
-    std::vector<StudentGrade> m_map{};
-public:
-    char & operator[](const std::string & name){
-        auto found { std::find_if(m_map.begin(), m_map.end(), [name](auto const &s){
-            return (s.m_name == name);
-        })};
-        if(found == m_map.end()){
-            m_map.push_back({name});
-            return m_map.back().m_grade;
-        }else{
-            return found->m_grade;
-        }
-    }
-    
-};
+#include"GradeMap.h"
 int main2()
 {
 	GradeMap grades{};
  
 	grades["Joe"] = 'A';
 	grades["Frank"] = 'B';
-    auto gJoe{grades["Joe"]};       // undefined behavior , holding & to vector element
-    auto gFrank{grades["Frank"]};   // bz the vector can get resize any time
+    auto gJoe{grades["Joe"]};       // with the old vector storage holding a & here was undefined behavior,
+    auto gFrank{grades["Frank"]};   // the vector could resize any time; GradeMap.h keeps records in place
     grades["Harry"] = 'C';
 	std::cout << "Joe has a grade of " << grades["Joe"] << '\n';
 	std::cout << "Frank has a grade of " << grades["Frank"] << '\n';
@@ -141,24 +86,7 @@ int main3(){
 }
 
 //eg.4
-class Average{
-    std::int_least32_t m_sum{};
-    std::int_least8_t m_count{};
-    public:
-    Average(int sum=0, int count=0):m_sum(sum), m_count(count){};
-    /*Average(const Average & src){
-        *this = src;
-    }*///default is enough
-    Average & operator+=(int x){
-        m_count++;
-        m_sum +=x;
-        return *this;
-    }
-    friend std::ostream & operator<<(std::ostream & out, const Average & avg){
-        out<<static_cast<double>(avg.m_sum)/avg.m_count<<"\n";
-        return out;
-    }
-};
+#include"Average.h"// 64 bit count, compensated sum, variance, merge
 int main4()
 {
 	Average avg{};
@@ -187,52 +115,7 @@ int main4()
 //e.g 5
 #include <iostream>
 #include<cassert>
- class IntArray{
-     int m_size{0};
-     int *m_arr{nullptr};
-
-public:
-    IntArray() = delete;
-    IntArray(int size):m_size{size}{
-        assert(size>0);
-        m_arr= new int[size]{};
-    };
-    void deepcopy(const IntArray & src) {
-        if(m_arr!= nullptr){
-            delete[] m_arr;
-            m_arr = nullptr;
-        }
-        m_size = src.m_size;
-        if(src.m_arr){
-            m_arr = new int[src.m_size]{};
-            for(int i =0; i <src.m_size; i++){
-                m_arr[i]= src.m_arr[i];
-            }
-        }
-    }
-    IntArray(const IntArray &src){
-        deepcopy(src);
-    }
-    IntArray & operator=(const IntArray &src){
-        if(this == &src)
-            return *this;
-        deepcopy(src);
-        return *this;
-    }
-    int& operator[](int index){
-        assert((index >= 0 )&& (index< m_size));
-        return m_arr[index];
-    }
-    friend std::ostream & operator <<(std::ostream &out, const IntArray & arr){
-        for(int i =0; i < arr.m_size; i++)
-            out<<arr.m_arr[i]<<" ";
-        out<<"\n";
-        return out;
-    }
-    ~IntArray(){
-        delete[] m_arr;
-    }
- };
+#include"IntArray.h"// move support, assignment reuses the buffer
 IntArray fillArray()
 {
 	IntArray a(5);